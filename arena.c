@@ -0,0 +1,91 @@
+// 領域（アリーナ）によるメモリ確保
+//
+// コンパイラが作るオブジェクトのほとんどは、個別に解放されることがなく、
+// 寿命が同じもの同士でまとまっている。例えば型はコンパイルの間ずっと使われ、
+// 関数の本体のノードやローカル変数は、その関数のコードを生成し終えれば
+// 不要になる。そこで、寿命ごとに領域を分け、オブジェクトは領域のブロックから
+// ポインタを進めるだけで切り出し、不要になったら領域ごとまとめて解放する。
+
+#include "chibicc.h"
+
+// ブロックの大きさ。小さな領域が無駄に大きくならないよう、最初の
+// ブロックは小さくし、ブロックを足すたびに倍にしていく
+#define ARENA_MIN_BLOCK_SIZE (4 * 1024)
+#define ARENA_MAX_BLOCK_SIZE (256 * 1024)
+
+// 切り出すオブジェクトのアラインメント。コンパイラのオブジェクトはどれも
+// ポインタより大きなアラインメントを必要としない
+#define ARENA_ALIGN 8
+
+struct ArenaBlock {
+    ArenaBlock *next;
+    max_align_t data[];
+};
+
+// コンパイルの間ずっと使われるオブジェクト（型、構造体のメンバ、
+// グローバル変数、インターンした文字列など）の領域
+Arena perm_arena;
+
+// 関数の本体のノード、ローカル変数、ブロックスコープの領域。
+// コードを生成し終えたら解放する
+Arena ast_arena;
+
+// ゼロで初期化した size バイトの領域を確保する
+void *arena_alloc(Arena *arena, size_t size) {
+    size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+
+    if ((size_t)(arena->end - arena->cur) < size) {
+        size_t cap = ARENA_MIN_BLOCK_SIZE;
+        if (arena->blocks)
+            cap = (arena->end - (char *)arena->blocks->data) * 2;
+        if (cap > ARENA_MAX_BLOCK_SIZE)
+            cap = ARENA_MAX_BLOCK_SIZE;
+        if (cap < size)
+            cap = size;
+
+        ArenaBlock *blk = calloc(1, sizeof(ArenaBlock) + cap);
+        if (!blk)
+            error("メモリが足りません");
+        blk->next = arena->blocks;
+        arena->blocks = blk;
+        arena->cur = (char *)blk->data;
+        arena->end = arena->cur + cap;
+    }
+
+    void *p = arena->cur;
+    arena->cur += size;
+    return p;
+}
+
+// `s` の先頭 `len` バイトをヌル文字で終端した文字列として領域に複製する
+char *arena_strndup(Arena *arena, char *s, size_t len) {
+    char *p = arena_alloc(arena, len + 1);
+    memcpy(p, s, len);
+    return p;
+}
+
+// 領域から確保したオブジェクトをすべて解放する。領域は空になり、
+// 引き続き使うことができる
+void arena_release(Arena *arena) {
+    ArenaBlock *blk = arena->blocks;
+    while (blk) {
+        ArenaBlock *next = blk->next;
+        free(blk);
+        blk = next;
+    }
+    *arena = (Arena){};
+}
+
+// コンパイラの状態をすべて捨て、同じプロセスで別の入力をコンパイルできる
+// ようにする。各モジュールの状態を初期状態に戻してから、領域を解放する。
+// コマンドラインで与える設定（インクルードパスやエラーの数の上限）は残す
+void reset_compiler(void) {
+    reset_parser();
+    reset_astfile();
+    reset_preprocessor();
+    reset_tokenizer();
+    reset_types();
+    reset_strings();
+    arena_release(&ast_arena);
+    arena_release(&perm_arena);
+}
@@ -0,0 +1,736 @@
+// AST ファイル
+//
+// パースした結果（グローバル変数と関数の Obj、型、関数の本体の構文木）を
+// バイナリ形式のファイルに書き出し、またそれを読み込んでコード生成に渡す。
+// 書き出しておけば、同じプログラムを使うたびに C のソースをトークナイズして
+// パースし直さずに済む。
+//
+// ファイルにはポインタを含めない。オブジェクトは種類ごとの表に固定長の
+// レコードとして並べ、互いを表の中の番号で参照する（-1 は NULL を表す）。
+// 名前などの文字列は文字列表にまとめ、その中の位置で参照する。読み込むときは
+// ファイルをメモリにマップし、レコードからコンパイラのオブジェクトを組み
+// 立て直す。文字列はマップした領域をそのまま指す。
+//
+// レコードはこのコンパイラの動くホストのバイト順で書く。形式を変えたら
+// AST_VERSION を上げること。
+//
+
+#include "chibicc.h"
+
+#define AST_MAGIC "chibiast"
+#define AST_VERSION 1
+
+// 表の位置と、レコードの数
+typedef struct {
+    int64_t offset; // ファイルの先頭からのバイト数。8 の倍数
+    int64_t cnt;
+} AstTable;
+
+typedef struct {
+    char magic[8];
+    int32_t version;
+    int32_t prog;       // 最初のグローバル変数
+    AstTable files;     // AstFile
+    AstTable locs;      // AstLoc
+    AstTable types;     // AstType
+    AstTable typerefs;  // int32_t。関数の型の仮引数の型の並び
+    AstTable members;   // AstMember
+    AstTable objs;      // AstObj
+    AstTable nodes;     // AstNode
+    AstTable strs;      // char。ヌル文字で終わる文字列と、初期値のバイト列
+} AstHeader;
+
+// 入力ファイル。ソースは含めないので、行の数だけを持つ
+typedef struct {
+    int32_t name;
+    int32_t line_cnt;
+} AstFile;
+
+// ノードの位置。同じ行のノードは同じレコードを共有する
+typedef struct {
+    int32_t file_no;
+    int32_t line_no;
+} AstLoc;
+
+typedef struct {
+    int32_t kind;
+    int32_t size;
+    int32_t align;
+    int32_t array_len;
+    int32_t base;
+    int32_t return_ty;
+    int32_t params;     // typerefs の中の最初の仮引数の位置
+    int32_t param_cnt;
+    int32_t members;    // 最初のメンバ。メンバは members に続けて並ぶ
+    int32_t member_cnt;
+} AstType;
+
+typedef struct {
+    int32_t ty;
+    int32_t name;
+    int32_t offset;
+} AstMember;
+
+typedef struct {
+    int32_t next;
+    int32_t name;
+    int32_t ty;
+    int32_t init_data;  // 型の大きさ分のバイト列
+    uint8_t is_local;   // 以下の 3 つは 0 か 1。読み込むときに確かめられるよう
+    uint8_t is_function; // bool にはしない
+    uint8_t is_definition;
+    int32_t params;
+    int32_t body;
+    int32_t locals;
+} AstObj;
+
+// 構文木のノード。ref の使い方はノードの種類による（read_node を参照）。
+// 子と next は必ず親より後ろに置く
+typedef struct {
+    int32_t kind;
+    int32_t ty;
+    int32_t loc;
+    int32_t next;
+    union {
+        int32_t ref[4];
+        int64_t val;
+    };
+} AstNode;
+
+//
+// 書き出し
+//
+// パーサは関数をひとつパースするたびに構文木を解放するので、その前に
+// レコードにしておく。レコードは表ごとにメモリに溜めておき、プログラム全体を
+// パースし終えたらまとめて書き出す。
+//
+
+// レコードを溜めておく表
+typedef struct {
+    char *data;
+    int cnt;
+    int cap;
+} Table;
+
+static FILE *ast_out;
+
+static Table files, locs, types, typerefs, members, objs, nodes, strs;
+
+// ポインタからレコードの番号を引く表。ローカル変数の表は関数ごとに作り直す
+static HashMap loc_ids, type_ids, member_ids, global_ids, local_ids, str_ids;
+
+// 表にゼロで埋めたレコードを `cnt` 個加え、最初のレコードの番号を返す。
+// 表は伸びると移動するので、レコードへのポインタは持ち続けないこと
+static int32_t add_records(Table *t, size_t size, int cnt) {
+    if (t->cnt + cnt > t->cap) {
+        while (t->cnt + cnt > t->cap)
+            t->cap = t->cap ? t->cap * 2 : 256;
+        t->data = realloc(t->data, size * t->cap);
+        if (!t->data)
+            error("メモリが足りません");
+    }
+    memset(t->data + size * t->cnt, 0, size * cnt);
+    t->cnt += cnt;
+    return t->cnt - cnt;
+}
+
+static int32_t get_id(HashMap *map, void *key, int keylen) {
+    void *id = hashmap_get2(map, key, keylen);
+    return id ? (intptr_t)id - 1 : -1;
+}
+
+// `key` のコピーを `arena` に置いて、番号を登録する
+static void put_id(HashMap *map, Arena *arena, void *key, int keylen, int32_t id) {
+    char *copy = memcpy(arena_alloc(arena, keylen), key, keylen);
+    hashmap_put2(map, copy, keylen, (void *)(intptr_t)(id + 1));
+}
+
+// 文字列表に長さ `len` のバイト列を加え、その位置を返す
+static int32_t add_bytes(char *s, int len) {
+    int32_t pos = add_records(&strs, 1, len);
+    memcpy(strs.data + pos, s, len);
+    return pos;
+}
+
+// 文字列を文字列表に加え、その位置を返す。同じ文字列は一度だけ加える
+static int32_t str_ref(char *s) {
+    if (!s)
+        return -1;
+    int len = strlen(s);
+    int32_t pos = get_id(&str_ids, s, len);
+    if (pos == -1) {
+        pos = add_bytes(s, len + 1);
+        put_id(&str_ids, &perm_arena, s, len, pos);
+    }
+    return pos;
+}
+
+static int32_t loc_ref(Token *tok) {
+    // トークンの連結でできたトークンは一覧にないファイルを指すので、
+    // ファイルは番号で区別する
+    int32_t key[2] = {tok->file->file_no, tok->line_no};
+    int32_t id = get_id(&loc_ids, key, sizeof(key));
+    if (id == -1) {
+        id = add_records(&locs, sizeof(AstLoc), 1);
+        ((AstLoc *)locs.data)[id] = (AstLoc){key[0], key[1]};
+        put_id(&loc_ids, &perm_arena, key, sizeof(key), id);
+    }
+    return id;
+}
+
+static int32_t type_ref(Type *ty) {
+    if (!ty)
+        return -1;
+    int32_t id = get_id(&type_ids, &ty, sizeof(ty));
+    if (id != -1)
+        return id;
+
+    // 型は循環して参照しうるので、先に番号を登録してから参照先をたどる
+    id = add_records(&types, sizeof(AstType), 1);
+    put_id(&type_ids, &perm_arena, &ty, sizeof(ty), id);
+
+    AstType rec = {
+        .kind = ty->kind,
+        .size = ty->size,
+        .align = ty->align,
+        .array_len = ty->array_len,
+    };
+    rec.base = type_ref(ty->base);
+    rec.return_ty = type_ref(ty->return_ty);
+
+    rec.params = add_records(&typerefs, sizeof(int32_t), ty->param_cnt);
+    rec.param_cnt = ty->param_cnt;
+    for (int i = 0; i < ty->param_cnt; i++) {
+        int32_t param = type_ref(ty->params[i]);
+        ((int32_t *)typerefs.data)[rec.params + i] = param;
+    }
+
+    for (Member *mem = ty->members; mem; mem = mem->next)
+        rec.member_cnt++;
+    rec.members = add_records(&members, sizeof(AstMember), rec.member_cnt);
+    int32_t i = rec.members;
+    for (Member *mem = ty->members; mem; mem = mem->next, i++) {
+        put_id(&member_ids, &perm_arena, &mem, sizeof(mem), i);
+        AstMember m = {type_ref(mem->ty), str_ref(mem->name), mem->offset};
+        ((AstMember *)members.data)[i] = m;
+    }
+
+    ((AstType *)types.data)[id] = rec;
+    return id;
+}
+
+static int32_t member_ref(Member *mem) {
+    int32_t id = get_id(&member_ids, &mem, sizeof(mem));
+    if (id == -1)
+        unreachable();
+    return id;
+}
+
+// 変数のレコードを返す。関数の本体などは emit_ast_function で埋める
+static int32_t obj_ref(Obj *var) {
+    if (!var)
+        return -1;
+
+    // ローカル変数は関数の本体とともに解放され、そのアドレスは使い回される
+    HashMap *map = var->is_local ? &local_ids : &global_ids;
+    Arena *arena = var->is_local ? &ast_arena : &perm_arena;
+    int32_t id = get_id(map, &var, sizeof(var));
+    if (id != -1)
+        return id;
+
+    id = add_records(&objs, sizeof(AstObj), 1);
+    put_id(map, arena, &var, sizeof(var), id);
+
+    AstObj rec = {
+        .next = -1,
+        .name = str_ref(var->name),
+        .ty = type_ref(var->ty),
+        .init_data = var->init_data ? add_bytes(var->init_data, var->ty->size) : -1,
+        .is_local = var->is_local,
+        .is_function = var->is_function,
+        .is_definition = var->is_definition,
+        .params = -1,
+        .body = -1,
+        .locals = -1,
+    };
+    ((AstObj *)objs.data)[id] = rec;
+    return id;
+}
+
+// 変数のリストのレコードを作り、先頭の番号を返す
+static int32_t obj_list_ref(Obj *var) {
+    int32_t first = obj_ref(var);
+    for (; var && var->next; var = var->next) {
+        int32_t next = obj_ref(var->next);
+        ((AstObj *)objs.data)[obj_ref(var)].next = next;
+    }
+    return first;
+}
+
+// ノードのリストのレコードを作り、先頭の番号を返す
+static int32_t node_ref(Node *node) {
+    int32_t first = -1;
+    int32_t prev = -1;
+
+    for (; node; node = node->next) {
+        int32_t id = add_records(&nodes, sizeof(AstNode), 1);
+        if (prev == -1)
+            first = id;
+        else
+            ((AstNode *)nodes.data)[prev].next = id;
+        prev = id;
+
+        AstNode rec = {
+            .kind = node->kind,
+            .ty = type_ref(node->ty),
+            .loc = loc_ref(node->tok),
+            .next = -1,
+        };
+        switch (node->kind) {
+        case ND_NUM:
+            rec.val = node->val;
+            break;
+        case ND_VAR:
+            rec.ref[0] = obj_ref(node->var);
+            break;
+        case ND_FUNCALL:
+            rec.ref[0] = node_ref(node->args);
+            rec.ref[1] = str_ref(node->funcname);
+            break;
+        case ND_BLOCK:
+        case ND_STMT_EXPR:
+            rec.ref[0] = node_ref(node->body);
+            break;
+        case ND_IF:
+            rec.ref[0] = node_ref(node->cond);
+            rec.ref[1] = node_ref(node->then);
+            rec.ref[2] = node_ref(node->els);
+            break;
+        case ND_FOR:
+            rec.ref[0] = node_ref(node->cond);
+            rec.ref[1] = node_ref(node->then);
+            rec.ref[2] = node_ref(node->init);
+            rec.ref[3] = node_ref(node->inc);
+            break;
+        case ND_MEMBER:
+            rec.ref[0] = node_ref(node->lhs);
+            rec.ref[1] = member_ref(node->member);
+            break;
+        default:
+            rec.ref[0] = node_ref(node->lhs);
+            rec.ref[1] = node_ref(node->rhs);
+            break;
+        }
+        ((AstNode *)nodes.data)[id] = rec;
+    }
+    return first;
+}
+
+// 出力先を設定する
+void emit_ast_init(FILE *out) {
+    ast_out = out;
+}
+
+// 関数定義をレコードにする。パーサは関数をひとつパースするたびにこれを呼び、
+// 戻ったらその関数の構文木を解放する
+void emit_ast_function(Obj *fn) {
+    int32_t id = obj_ref(fn);
+    int32_t locals = obj_list_ref(fn->locals);
+    int32_t params = obj_ref(fn->params);
+    int32_t body = node_ref(fn->body);
+
+    AstObj *rec = &((AstObj *)objs.data)[id];
+    rec->locals = locals;
+    rec->params = params;
+    rec->body = body;
+
+    free(local_ids.buckets);
+    local_ids = (HashMap){};
+}
+
+// 表を 8 バイト境界から書き出し、その位置を返す
+static AstTable write_table(Table *t, size_t size, int64_t *pos) {
+    static char zero[8];
+    int pad = align_to(*pos, 8) - *pos;
+    fwrite(zero, 1, pad, ast_out);
+    *pos += pad;
+
+    AstTable tab = {*pos, t->cnt};
+    fwrite(t->data, size, t->cnt, ast_out);
+    *pos += size * t->cnt;
+    return tab;
+}
+
+// パースし終えたら、グローバル変数と入力ファイルのレコードを作り、
+// すべての表をファイルに書き出す
+void emit_ast_data(Obj *prog) {
+    AstHeader hdr = {.magic = AST_MAGIC, .version = AST_VERSION};
+    hdr.prog = obj_list_ref(prog);
+
+    File **input = get_input_files();
+    for (int i = 0; input[i]; i++) {
+        int32_t id = add_records(&files, sizeof(AstFile), 1);
+        ((AstFile *)files.data)[id].name = str_ref(input[i]->name);
+    }
+    for (int i = 0; i < locs.cnt; i++) {
+        AstLoc *loc = &((AstLoc *)locs.data)[i];
+        AstFile *file = &((AstFile *)files.data)[loc->file_no - 1];
+        if (file->line_cnt < loc->line_no)
+            file->line_cnt = loc->line_no;
+    }
+
+    // ヘッダは表の位置が決まってから書き直す
+    int64_t pos = sizeof(hdr);
+    fwrite(&hdr, sizeof(hdr), 1, ast_out);
+    hdr.files = write_table(&files, sizeof(AstFile), &pos);
+    hdr.locs = write_table(&locs, sizeof(AstLoc), &pos);
+    hdr.types = write_table(&types, sizeof(AstType), &pos);
+    hdr.typerefs = write_table(&typerefs, sizeof(int32_t), &pos);
+    hdr.members = write_table(&members, sizeof(AstMember), &pos);
+    hdr.objs = write_table(&objs, sizeof(AstObj), &pos);
+    hdr.nodes = write_table(&nodes, sizeof(AstNode), &pos);
+    hdr.strs = write_table(&strs, 1, &pos);
+
+    if (fseek(ast_out, 0, SEEK_SET) || fwrite(&hdr, sizeof(hdr), 1, ast_out) != 1)
+        error("AST ファイルを書き出せませんでした: %s", strerror(errno));
+    fflush(ast_out);
+}
+
+//
+// 読み込み
+//
+// 表の中の番号はすべて範囲を確かめてから使う。ノードの子と next は
+// 親より後ろにあることも確かめるので、壊れたファイルを読んでも構文木が
+// 循環することはない。
+//
+
+// 読み込んでいるファイルと、マップした内容
+static struct {
+    char *path;
+    char *buf;
+    size_t size;
+    AstHeader *hdr;
+} in;
+
+// 組み立て直したオブジェクト。番号で引く
+static Token *loaded_locs;
+static Type *loaded_types;
+static Member *loaded_members;
+static Obj *loaded_objs;
+static Node *loaded_nodes;
+
+static void check(bool cond) {
+    if (!cond)
+        error("AST ファイルが壊れています: %s", in.path);
+}
+
+// 表の先頭を返す
+static void *table(AstTable *tab, size_t size) {
+    check(tab->offset >= 0 && tab->cnt >= 0);
+    size_t offset = tab->offset;
+    check(offset >= sizeof(AstHeader) && offset % 8 == 0 && offset <= in.size &&
+          (size_t)tab->cnt <= (in.size - offset) / size);
+    return in.buf + offset;
+}
+
+// 番号が 0 以上 `cnt` 未満であることを確かめる。-1 は NULL とする
+static int32_t index_of(int32_t id, int64_t cnt) {
+    check(-1 <= id && id < cnt);
+    return id;
+}
+
+// 文字列表の `pos` から `len` バイトを返す。`len` が -1 ならヌル文字で終わる文字列
+static char *read_bytes(int32_t pos, int64_t len) {
+    if (pos == -1)
+        return NULL;
+    AstTable *tab = &in.hdr->strs;
+    check(0 <= pos && pos < tab->cnt);
+    if (len == -1)
+        check(memchr(in.buf + tab->offset + pos, '\0', tab->cnt - pos));
+    else
+        check(len <= tab->cnt - pos);
+    return in.buf + tab->offset + pos;
+}
+
+static Type *read_type(int32_t id) {
+    id = index_of(id, in.hdr->types.cnt);
+    return id == -1 ? NULL : &loaded_types[id];
+}
+
+static Obj *read_obj(int32_t id) {
+    id = index_of(id, in.hdr->objs.cnt);
+    return id == -1 ? NULL : &loaded_objs[id];
+}
+
+// 文のノードであれば真を返す。コード生成はノードの種類を確かめずに子を
+// たどるので、文を置く位置には文を、式を置く位置には式を置かなければならない
+static bool is_stmt(int32_t kind) {
+    return kind == ND_RETURN || kind == ND_IF || kind == ND_FOR ||
+           kind == ND_BLOCK || kind == ND_EXPR_STMT;
+}
+
+// `parent` の子のノードを返す。`stmt` が真であれば子は文、偽であれば式
+static Node *read_node(int32_t id, int32_t parent, bool stmt) {
+    id = index_of(id, in.hdr->nodes.cnt);
+    if (id == -1)
+        return NULL;
+    check(id > parent);
+    AstNode *recs = (AstNode *)(in.buf + in.hdr->nodes.offset);
+    check(is_stmt(recs[id].kind) == stmt);
+    return &loaded_nodes[id];
+}
+
+// ソースを持たない入力ファイルを作る。行の数は AST ファイルに書かれた
+// だけあってよく、ファイルの大きさでは抑えられないので、行の表は作らない。
+// 位置はどれも 1 行だけの空の内容を指し、エラーメッセージでは空行を表示する
+static void load_files(void) {
+    AstFile *recs = table(&in.hdr->files, sizeof(AstFile));
+    for (int i = 0; i < in.hdr->files.cnt; i++) {
+        check(0 <= recs[i].line_cnt && recs[i].line_cnt < INT32_MAX);
+        char *contents = strdup("\n");
+        if (!contents)
+            error("メモリが足りません");
+        add_file(read_bytes(recs[i].name, -1), contents);
+    }
+
+    AstLoc *locs = table(&in.hdr->locs, sizeof(AstLoc));
+    loaded_locs = arena_alloc(&perm_arena, sizeof(Token) * in.hdr->locs.cnt);
+    File **input = get_input_files();
+    for (int i = 0; i < in.hdr->locs.cnt; i++) {
+        check(1 <= locs[i].file_no && locs[i].file_no <= in.hdr->files.cnt);
+        check(1 <= locs[i].line_no && locs[i].line_no <= recs[locs[i].file_no - 1].line_cnt);
+
+        Token *tok = &loaded_locs[i];
+        tok->kind = TK_EOF;
+        tok->file = input[locs[i].file_no - 1];
+        tok->line_no = locs[i].line_no;
+        tok->loc = tok->file->contents;
+    }
+}
+
+static void load_types(void) {
+    AstType *recs = table(&in.hdr->types, sizeof(AstType));
+    int32_t *refs = table(&in.hdr->typerefs, sizeof(int32_t));
+    AstMember *mems = table(&in.hdr->members, sizeof(AstMember));
+    int64_t nrefs = in.hdr->typerefs.cnt;
+    int64_t nmems = in.hdr->members.cnt;
+
+    loaded_types = arena_alloc(&perm_arena, sizeof(Type) * in.hdr->types.cnt);
+    loaded_members = arena_alloc(&perm_arena, sizeof(Member) * nmems);
+
+    for (int i = 0; i < in.hdr->types.cnt; i++) {
+        AstType *rec = &recs[i];
+        Type *ty = &loaded_types[i];
+        check(TY_VOID <= rec->kind && rec->kind <= TY_UNION);
+
+        // コード生成は大きさをアラインメントで切り上げるので、関数以外の型の
+        // アラインメントは正の 2 の冪でなければならない
+        if (rec->kind != TY_FUNC)
+            check(rec->size >= 0 && rec->align > 0 && (rec->align & (rec->align - 1)) == 0);
+        ty->kind = rec->kind;
+        ty->size = rec->size;
+        ty->align = rec->align;
+        ty->array_len = rec->array_len;
+        ty->base = read_type(rec->base);
+        ty->return_ty = read_type(rec->return_ty);
+
+        check(rec->param_cnt >= 0 && 0 <= rec->params && rec->params <= nrefs - rec->param_cnt);
+        ty->param_cnt = rec->param_cnt;
+        ty->params = arena_alloc(&perm_arena, sizeof(Type *) * rec->param_cnt);
+        for (int j = 0; j < rec->param_cnt; j++)
+            ty->params[j] = read_type(refs[rec->params + j]);
+
+        check(rec->member_cnt >= 0 && 0 <= rec->members && rec->members <= nmems - rec->member_cnt);
+        Member head = {};
+        Member *cur = &head;
+        for (int j = rec->members; j < rec->members + rec->member_cnt; j++) {
+            Member *mem = &loaded_members[j];
+            mem->ty = read_type(mems[j].ty);
+            mem->name = read_bytes(mems[j].name, -1);
+            mem->offset = mems[j].offset;
+            cur = cur->next = mem;
+        }
+        ty->members = head.next;
+    }
+}
+
+// 変数のリストをたどり、循環していないことを確かめる。`local` が真であれば
+// 関数の仮引数またはローカル変数のリスト、偽であればグローバル変数のリスト
+static void check_list(Obj *var, bool local) {
+    for (int64_t n = 0; var; var = var->next) {
+        check(n++ < in.hdr->objs.cnt);
+        check(var->is_local == local);
+        if (local)
+            check(var->ty->kind != TY_FUNC);
+        else
+            check(var->is_function == (var->ty->kind == TY_FUNC));
+    }
+}
+
+static void load_objs(void) {
+    AstObj *recs = table(&in.hdr->objs, sizeof(AstObj));
+    loaded_objs = arena_alloc(&perm_arena, sizeof(Obj) * in.hdr->objs.cnt);
+
+    for (int i = 0; i < in.hdr->objs.cnt; i++) {
+        AstObj *rec = &recs[i];
+        Obj *var = &loaded_objs[i];
+        var->next = read_obj(rec->next);
+        var->name = read_bytes(rec->name, -1);
+        var->ty = read_type(rec->ty);
+        check(var->name && var->ty);
+        check(rec->is_local <= 1 && rec->is_function <= 1 && rec->is_definition <= 1);
+        var->is_local = rec->is_local;
+        var->is_function = rec->is_function;
+        var->is_definition = rec->is_definition;
+        var->init_data = read_bytes(rec->init_data, var->ty->size);
+        var->params = read_obj(rec->params);
+        var->locals = read_obj(rec->locals);
+        var->body = read_node(rec->body, -1, true);
+        check(!var->is_function || !var->is_definition || var->body);
+    }
+
+    for (int i = 0; i < in.hdr->objs.cnt; i++) {
+        if (loaded_objs[i].body) {
+            check_list(loaded_objs[i].params, true);
+            check_list(loaded_objs[i].locals, true);
+        }
+    }
+}
+
+static void load_nodes(void) {
+    AstNode *recs = table(&in.hdr->nodes, sizeof(AstNode));
+
+    for (int i = 0; i < in.hdr->nodes.cnt; i++) {
+        AstNode *rec = &recs[i];
+        Node *node = &loaded_nodes[i];
+        check(ND_ADD <= rec->kind && rec->kind <= ND_NUM);
+        node->kind = rec->kind;
+        node->ty = read_type(rec->ty);
+        node->next = read_node(rec->next, i, is_stmt(rec->kind));
+        check(0 <= rec->loc && rec->loc < in.hdr->locs.cnt);
+        node->tok = &loaded_locs[rec->loc];
+
+        switch (node->kind) {
+        case ND_NUM:
+            node->val = rec->val;
+            break;
+        case ND_VAR:
+            node->var = read_obj(rec->ref[0]);
+            check(node->var);
+            break;
+        case ND_FUNCALL:
+            node->args = read_node(rec->ref[0], i, false);
+            node->funcname = read_bytes(rec->ref[1], -1);
+            check(node->funcname);
+            break;
+        case ND_BLOCK:
+        case ND_STMT_EXPR:
+            node->body = read_node(rec->ref[0], i, true);
+            break;
+        case ND_IF:
+            node->cond = read_node(rec->ref[0], i, false);
+            node->then = read_node(rec->ref[1], i, true);
+            node->els = read_node(rec->ref[2], i, true);
+            check(node->cond && node->then);
+            break;
+        case ND_FOR:
+            node->cond = read_node(rec->ref[0], i, false);
+            node->then = read_node(rec->ref[1], i, true);
+            node->init = read_node(rec->ref[2], i, true);
+            node->inc = read_node(rec->ref[3], i, false);
+            check(node->then);
+            break;
+        case ND_MEMBER: {
+            node->lhs = read_node(rec->ref[0], i, false);
+            int32_t mem = index_of(rec->ref[1], in.hdr->members.cnt);
+            check(node->lhs && mem != -1);
+            node->member = &loaded_members[mem];
+            break;
+        }
+        case ND_NEG:
+        case ND_ADDR:
+        case ND_DEREF:
+        case ND_RETURN:
+        case ND_EXPR_STMT:
+            node->lhs = read_node(rec->ref[0], i, false);
+            check(node->lhs);
+            break;
+        default:
+            node->lhs = read_node(rec->ref[0], i, false);
+            node->rhs = read_node(rec->ref[1], i, false);
+            check(node->lhs && node->rhs);
+            break;
+        }
+    }
+}
+
+// AST ファイルを読み込み、グローバル変数のリストを返す。関数定義の Obj は
+// 本体を持ち、そのままコード生成に渡せる
+Obj *load_ast(char *path) {
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        error("AST ファイルを開けませんでした: %s: %s", path, strerror(errno));
+
+    struct stat st;
+    if (fstat(fileno(fp), &st) || !S_ISREG(st.st_mode))
+        error("AST ファイルを読めませんでした: %s", path);
+
+    in.path = path;
+    in.size = st.st_size;
+    if (in.size < sizeof(AstHeader))
+        error("AST ファイルではありません: %s", path);
+    in.buf = mmap(NULL, in.size, PROT_READ, MAP_PRIVATE, fileno(fp), 0);
+    if (in.buf == MAP_FAILED)
+        error("AST ファイルを読めませんでした: %s: %s", path, strerror(errno));
+    fclose(fp);
+
+    in.hdr = (AstHeader *)in.buf;
+    if (memcmp(in.hdr->magic, AST_MAGIC, sizeof(in.hdr->magic)))
+        error("AST ファイルではありません: %s", path);
+    if (in.hdr->version != AST_VERSION)
+        error("AST ファイルの版が異なります: %s", path);
+
+    // 表がファイルに収まっていることを確かめる。文字列表の文字列の
+    // 終わりは、使うときに確かめる
+    table(&in.hdr->objs, sizeof(AstObj));
+    table(&in.hdr->nodes, sizeof(AstNode));
+    table(&in.hdr->strs, 1);
+
+    // 変数は本体のノードを、ノードは型、変数、位置を参照するので、
+    // ノードの領域を先に確保しておき、参照されるものから組み立てる
+    loaded_nodes = arena_alloc(&perm_arena, sizeof(Node) * in.hdr->nodes.cnt);
+    load_files();
+    load_types();
+    load_objs();
+    load_nodes();
+
+    Obj *prog = read_obj(in.hdr->prog);
+    check_list(prog, false);
+    return prog;
+}
+
+// AST ファイルの読み書きの状態を初期状態に戻す（reset_compiler を参照）。
+// 書き出す表と番号の表を解放し、読み込んだファイルをアンマップする
+void reset_astfile(void) {
+    Table *tables[] = {&files, &locs, &types, &typerefs, &members, &objs, &nodes, &strs};
+    for (size_t i = 0; i < sizeof(tables) / sizeof(*tables); i++) {
+        free(tables[i]->data);
+        *tables[i] = (Table){};
+    }
+
+    HashMap *maps[] = {&loc_ids, &type_ids, &member_ids, &global_ids, &local_ids, &str_ids};
+    for (size_t i = 0; i < sizeof(maps) / sizeof(*maps); i++) {
+        free(maps[i]->buckets);
+        *maps[i] = (HashMap){};
+    }
+    ast_out = NULL;
+
+    if (in.buf)
+        munmap(in.buf, in.size);
+    memset(&in, 0, sizeof(in));
+    loaded_locs = NULL;
+    loaded_types = NULL;
+    loaded_members = NULL;
+    loaded_objs = NULL;
+    loaded_nodes = NULL;
+}
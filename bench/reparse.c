@@ -0,0 +1,103 @@
+// 増分パースのベンチマーク
+//
+// 使い方: bench/reparse [ <file> ]
+//
+// ファイルを省略すると、合成した10万行の入力を使う。入力全体を
+// parse_retained でパースした後、ファイルの中ほどにある関数の本体の編集、
+// 宣言の追加、末尾への関数の追加をそれぞれ reparse でパースし直し、
+// かかった時間を測る。あわせて、編集の及ばない関数の Obj と構文木が
+// そのまま使われていることを確かめる。
+
+#include "../chibicc.h"
+#include <time.h>
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 合成した入力を一時ファイルに書き出し、そのパスを返す
+static char *gen_input(void) {
+    static char path[] = "/tmp/chibicc-bench-XXXXXX";
+    int fd = mkstemp(path);
+    if (fd == -1)
+        error("一時ファイルを作成できませんでした: %s", strerror(errno));
+
+    FILE *out = fdopen(fd, "w");
+    fprintf(out, "#define SCALE 3\n");
+    fprintf(out, "struct pair { int a; int b; };\n");
+    for (int i = 0; i < 10000; i++) {
+        fprintf(out, "int g_%d;\n", i);
+        fprintf(out, "// function %d\n", i);
+        fprintf(out, "int func_%d(int a, int b) {\n", i);
+        fprintf(out, "    struct pair p;\n");
+        fprintf(out, "    p.a = a * %d + SCALE;\n", i);
+        fprintf(out, "    p.b = b;\n");
+        fprintf(out, "    if (p.a >= p.b) return p.a - g_%d;\n", i);
+        fprintf(out, "    return \"str\"[0] + p.b;\n");
+        fprintf(out, "}\n\n");
+    }
+    fclose(out);
+    return path;
+}
+
+static Obj *find_function(Obj *prog, char *name) {
+    for (Obj *fn = prog; fn; fn = fn->next)
+        if (fn->is_function && fn->is_definition && !strcmp(fn->name, name))
+            return fn;
+    error("関数 %s が見つかりません", name);
+}
+
+// 入力ファイルで `s` が最初に現れる位置を返す
+static int offset_of(char *s) {
+    char *contents = get_input_files()[0]->contents;
+    char *p = strstr(contents, s);
+    if (!p)
+        error("%s が見つかりません", s);
+    return p - contents;
+}
+
+// [start, end) を `text` で置き換えてパースし直し、かかった時間を表示する
+static Obj *measure(char *label, int start, int end, char *text) {
+    double t = now();
+    Obj *prog = reparse(start, end, text, strlen(text));
+    double elapsed = now() - t;
+    if (!prog || error_cnt)
+        error("%s: パースし直せませんでした", label);
+    printf("%-16s %8.2f ms\n", label, elapsed * 1000);
+    return prog;
+}
+
+int main(int argc, char **argv) {
+    char *path = argc > 1 ? argv[1] : gen_input();
+
+    open_token_stream(path);
+    double t = now();
+    Obj *prog = parse_retained();
+    if (error_cnt)
+        error("入力にエラーがあります");
+    printf("initial parse    %8.2f ms\n", (now() - t) * 1000);
+
+    Obj *fn = find_function(prog, "func_1");
+    Node *body = fn->body;
+
+    int pos = offset_of("a * 5000 + SCALE");
+    prog = measure("body edit", pos, pos + 1, "b");
+    pos = offset_of("a * 5001 + SCALE");
+    prog = measure("body edit again", pos, pos + 1, "b");
+
+    pos = offset_of("int g_9000;");
+    prog = measure("declaration", pos, pos, "int added;\n");
+
+    int size = strlen(get_input_files()[0]->contents);
+    prog = measure("append", size, size, "int appended(int a) { return a + SCALE; }\n");
+
+    if (find_function(prog, "func_1") != fn || fn->body != body)
+        error("編集の及ばない関数がパースし直されています");
+    printf("untouched functions are reused\n");
+
+    if (argc == 1)
+        unlink(path);
+    return 0;
+}
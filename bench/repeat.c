@@ -0,0 +1,104 @@
+// コンパイラを同じプロセスで繰り返し使うベンチマーク
+//
+// 使い方: bench/repeat [ <file> [ <count> ] ]
+//
+// ファイルを省略すると、合成した入力を使う。入力を <count> 回（既定は
+// 5 回）コンパイルし、そのたびに reset_compiler で状態を捨てる。
+// コンパイルにかかった時間と、コンパイルを終えた時点の RSS を表示し、
+// 出力が毎回同じであること、RSS が増え続けないことを確かめる。
+
+#include "../chibicc.h"
+#include <time.h>
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 合成した入力を一時ファイルに書き出し、そのパスを返す。マクロの展開、
+// 連結、文字列化、文字列リテラル、構造体を含める
+static char *gen_input(void) {
+    static char path[] = "/tmp/chibicc-bench-XXXXXX";
+    int fd = mkstemp(path);
+    if (fd == -1)
+        error("一時ファイルを作成できませんでした: %s", strerror(errno));
+
+    FILE *out = fdopen(fd, "w");
+    fprintf(out, "#define SCALE 3\n");
+    fprintf(out, "#define NAME(x) func_ ## x\n");
+    fprintf(out, "#define STR(x) #x\n");
+    fprintf(out, "struct pair { int a; int b; };\n");
+    for (int i = 0; i < 10000; i++) {
+        fprintf(out, "int g_%d;\n", i);
+        fprintf(out, "int NAME(%d)(int a, int b) {\n", i);
+        fprintf(out, "    struct pair p;\n");
+        fprintf(out, "    p.a = a * %d + SCALE;\n", i);
+        fprintf(out, "    p.b = b;\n");
+        fprintf(out, "    if (p.a >= p.b) return p.a - g_%d;\n", i);
+        fprintf(out, "    return STR(p.b)[0] + \"str\"[1];\n");
+        fprintf(out, "}\n\n");
+    }
+    fclose(out);
+    return path;
+}
+
+// 現在の RSS を KB 単位で返す
+static long current_rss(void) {
+    long size, resident;
+    FILE *fp = fopen("/proc/self/statm", "r");
+    if (!fp || fscanf(fp, "%ld %ld", &size, &resident) != 2)
+        error("/proc/self/statm を読めませんでした");
+    fclose(fp);
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+// 入力をコンパイルし、出力したアセンブリを返す
+static char *compile(char *path, size_t *len) {
+    char *buf;
+    FILE *out = open_memstream(&buf, len);
+    open_token_stream(path);
+    codegen_init(out);
+    codegen_data(parse(codegen_function));
+    fclose(out);
+    return buf;
+}
+
+int main(int argc, char **argv) {
+    char *path = argc > 1 ? argv[1] : gen_input();
+    int count = argc > 2 ? atoi(argv[2]) : 5;
+
+    char *first = NULL;
+    size_t first_len = 0;
+    long base_rss = 0;
+    for (int i = 0; i < count; i++) {
+        double t = now();
+        size_t len;
+        char *buf = compile(path, &len);
+        reset_compiler();
+        long rss = current_rss();
+        printf("compile %-8d %8.2f ms %8ld KB\n", i + 1, (now() - t) * 1000, rss);
+
+        if (!first) {
+            first = buf;
+            first_len = len;
+            continue;
+        }
+        if (len != first_len || memcmp(buf, first, len))
+            error("%d回目の出力が1回目と異なります", i + 1);
+        free(buf);
+
+        // 2回目を基準にする。1回目の後は malloc が確保した領域が残る。
+        // 小さな入力では malloc の都合で揺れるので、少し余裕を見る
+        if (i == 1)
+            base_rss = rss;
+        else if (rss > base_rss + base_rss / 10 + 4096)
+            error("コンパイルを繰り返すと RSS が増え続けます");
+    }
+    printf("output is identical and memory does not grow\n");
+
+    free(first);
+    if (argc == 1)
+        unlink(path);
+    return 0;
+}
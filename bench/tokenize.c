@@ -0,0 +1,114 @@
+// 並列トークナイズのベンチマーク
+//
+// 使い方: bench/tokenize [ <file> [ <max-threads> ] ]
+//
+// ファイルを省略すると、合成した大きな入力を使う。スレッドの数を
+// 1, 2, 4, ... と増やしながら tokenize_parallel にかかる時間を測り、
+// 逐次的にトークナイズした場合と比較する。トークンは解放されないまま
+// 溜まっていくので、各測定は別のプロセスで行う。
+//
+// 並列トークナイズは実験的な機能なので、このベンチマークは make PARALLEL=1
+// でビルドした場合にだけ作られる。
+
+#include "../chibicc.h"
+#include <sys/wait.h>
+#include <time.h>
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 合成した入力を一時ファイルに書き出し、そのパスを返す
+static char *gen_input(void) {
+    static char path[] = "/tmp/chibicc-bench-XXXXXX";
+    int fd = mkstemp(path);
+    if (fd == -1)
+        error("一時ファイルを作成できませんでした: %s", strerror(errno));
+
+    FILE *out = fdopen(fd, "w");
+    for (int i = 0; i < 100000; i++) {
+        fprintf(out, "/* function %d\n * computes something */\n", i);
+        fprintf(out, "int func_%d(int a, int b) {\n", i);
+        fprintf(out, "    int x = a * %d + b; // scale\n", i);
+        fprintf(out, "    char *s = \"string \\\"%d\\\"\\n\";\n", i);
+        fprintf(out, "    if (x >= b && a != 0) return x - s[0];\n");
+        fprintf(out, "    return a->b <= b;\n}\n\n");
+    }
+    fclose(out);
+    return path;
+}
+
+// 残りのトークンをすべて読み捨て、その数を返す
+static long drain(void) {
+    long n = 0;
+    for (;;) {
+        Token *tok = read_toplevel();
+        if (tok->kind == TK_EOF)
+            return n;
+        for (Token *t = tok; t->kind != TK_EOF; t = t->next)
+            n++;
+        release_tokens(tok);
+    }
+}
+
+// path をトークナイズするのにかかった秒数を返す。
+// nthreads が0なら、並列化せずに read_toplevel で逐次的に読む。
+static double measure(char *path, int nthreads) {
+    int fds[2];
+    if (pipe(fds))
+        error("pipe: %s", strerror(errno));
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        open_token_stream(path);
+        double t = now();
+        if (nthreads)
+            tokenize_parallel(nthreads);
+        else
+            drain();
+        double elapsed = now() - t;
+        write(fds[1], &elapsed, sizeof(elapsed));
+        _exit(0);
+    }
+
+    double elapsed;
+    if (read(fds[0], &elapsed, sizeof(elapsed)) != sizeof(elapsed))
+        error("測定に失敗しました");
+    waitpid(pid, NULL, 0);
+    close(fds[0]);
+    close(fds[1]);
+    return elapsed;
+}
+
+// 3回測定して最も短い時間を返す
+static double best_of_3(char *path, int nthreads) {
+    double best = measure(path, nthreads);
+    for (int i = 0; i < 2; i++) {
+        double t = measure(path, nthreads);
+        if (t < best)
+            best = t;
+    }
+    return best;
+}
+
+int main(int argc, char **argv) {
+    char *path = argc > 1 ? argv[1] : gen_input();
+    int max_threads = argc > 2 ? atoi(argv[2]) : 16;
+
+    open_token_stream(path);
+    printf("%ld tokens\n", drain());
+
+    double seq = best_of_3(path, 0);
+    printf("sequential: %8.1f ms\n", seq * 1000);
+
+    for (int n = 1; n <= max_threads; n *= 2) {
+        double t = best_of_3(path, n);
+        printf("%2d threads: %8.1f ms (%.2fx)\n", n, t * 1000, seq / t);
+    }
+
+    if (argc == 1)
+        unlink(path);
+    return 0;
+}
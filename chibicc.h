@@ -2,27 +2,104 @@
 #include <assert.h>
 #include <ctype.h>
 #include <errno.h>
+#include <pthread.h>
+#include <setjmp.h>
+#include <stdatomic.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdnoreturn.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 typedef struct Type Type;
 typedef struct Node Node;
 typedef struct Member Member;
 
+//
+// arena.c
+//
+
+// 領域（アリーナ）。寿命の同じオブジェクトをまとめて確保し、まとめて解放する
+typedef struct ArenaBlock ArenaBlock;
+typedef struct {
+    ArenaBlock *blocks; // 確保したブロックのリスト（先頭がいま切り出しているもの）
+    char *cur;          // 先頭のブロックの未使用部分の始まり
+    char *end;          // 先頭のブロックの終わり
+} Arena;
+
+extern Arena perm_arena;
+extern Arena ast_arena;
+
+void *arena_alloc(Arena *arena, size_t size);
+char *arena_strndup(Arena *arena, char *s, size_t len);
+void arena_release(Arena *arena);
+void reset_compiler(void);
+
 //
 // strings.c
 //
 
+// インターンした識別子ごとに、パーサがその名前の現在の宣言を記録する領域。
+// 名前から宣言を引くのに、ハッシュ表を引く必要がなくなる。
+typedef struct {
+    void *var; // 変数または typedef の宣言（parse.c の VarScope）
+    void *tag; // 構造体タグの宣言（parse.c の TagScope）
+} Binding;
+
 char *format(char *fmt, ...);
+char *intern(char *s, int len);
+Binding *get_binding(char *atom);
+void reset_strings(void);
+
+//
+// hashmap.c
+//
+
+typedef struct {
+    char *key;
+    int keylen;
+    void *val;
+} HashEntry;
+
+typedef struct {
+    HashEntry *buckets;
+    int capacity;
+    int used;
+    Arena *arena; // NULL でなければ、バケットはこの領域から確保する
+} HashMap;
+
+void *hashmap_get(HashMap *map, char *key);
+void *hashmap_get2(HashMap *map, char *key, int keylen);
+void hashmap_put(HashMap *map, char *key, void *val);
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val);
 
 //
 // tokenize.c
 //
 
+// 入力ファイル
+typedef struct {
+    char *name;         // ファイル名
+    int file_no;        // .file ディレクティブで使うファイル番号
+    char *contents;     // ファイルの内容
+    size_t mapped;      // contents をメモリにマップしていれば、ファイルの大きさ
+
+    // 各行の先頭の位置。エラーメッセージで行を表示するのに使う
+    char **line_starts;
+    int line_cnt;
+    int line_cap;
+} File;
+
 // トークンの種類
 typedef enum {
     TK_IDENT,    // 識別子
@@ -33,41 +110,122 @@ typedef enum {
     TK_EOF,      // 入力の終わりを表すトークン
 } TokenKind;
 
+// キーワードと記号の種類を表すID。
+// １文字の記号は、その文字コード自体をIDとして用いる（例えば "(" のIDは '('）。
+// パーサはこのIDを見ることで、文字列の比較をせずにトークンを判別できる。
+typedef enum {
+    ID_NONE,
+
+    // キーワード
+    KW_RETURN = 128,
+    KW_IF,
+    KW_ELSE,
+    KW_FOR,
+    KW_WHILE,
+    KW_SIZEOF,
+
+    // 型指定子を始めるキーワード。KW_VOID から KW_TYPEDEF までは連続させること
+    KW_VOID,
+    KW_CHAR,
+    KW_SHORT,
+    KW_INT,
+    KW_LONG,
+    KW_STRUCT,
+    KW_UNION,
+    KW_TYPEDEF,
+
+    // ２文字以上の記号
+    PU_EQ,    // ==
+    PU_NE,    // !=
+    PU_LE,    // <=
+    PU_GE,    // >=
+    PU_ARROW, // ->
+    PU_LOGAND,   // &&
+    PU_LOGOR,    // ||
+    PU_HASHHASH, // ##
+    PU_ELLIPSIS, // ...
+} TokenId;
+
 typedef struct Token Token;
 
 // トークン型
+//
+// トークンはひとつずつ calloc せず、tokenize.c でまとめて確保した配列から
+// 切り出される。フィールドはパディングが生じないように並べてある。
 struct Token {
-    TokenKind kind; // トークンの型
     Token *next;    // 次の入力トークン
-    int64_t val;    // kindがTK_NUMの場合、その数値
+    int64_t val;    // kindがTK_NUMの場合はその数値、TK_STRの場合はstrの長さ
     char *loc;      // トークンの位置
+    char *str;      // kindがTK_STRの場合は文字列リテラルの内容（終端のヌル文字
+                    // '\0' を含む）、TK_IDENTの場合はインターンされた識別子名
+    File *file;     // トークンを含むファイル
     int len;        // トークンの長さ
-    Type *ty;       // kindがTK_STRの場合に用いる
-    char *str;      // 文字列リテラルの内容（終端はヌル文字 '\0'）
-
     int line_no;    // 行番号
+
+    // 種類とプリプロセッサが使うフラグは、一つのワードに詰めて持つ
+    TokenKind kind : 8;    // トークンの型
+    TokenId id : 8;        // kindがTK_KEYWORDまたはTK_PUNCTの場合、その種類
+    bool at_bol : 1;       // 行頭のトークンであれば真
+    bool has_space : 1;    // 直前に空白があれば真
+    bool no_expand : 1;    // マクロ展開しないトークンであれば真
+    bool is_typespec : 1;  // 型指定子を始めるキーワードであれば真
 };
 
-void error(char *fmt, ...);
-void error_at(char *loc, char *fmt, ...);
-void error_tok(Token *tok, char *fmt, ...);
+extern jmp_buf *error_recovery;
+extern int error_cnt;
+extern int max_errors;
+
+noreturn void error(char *fmt, ...);
+noreturn void error_at(char *loc, char *fmt, ...);
+noreturn void error_tok(Token *tok, char *fmt, ...);
 bool equal(Token *tok, char *op);
 Token *skip(Token *tok, char *op);
 bool consume(Token **rest, Token *tok, char *str);
-Token *tokenize_file(char *filename);
+Token *copy_token(Token *tok);
+void free_token(Token *tok);
+void release_tokens(Token *tok);
+File **get_input_files(void);
+File *new_file(char *name, int file_no, char *contents);
+File *add_file(char *name, char *contents);
+Token *tokenize(File *file);
+Token *tokenize_file(char *path);
+void open_token_stream(char *path);
+char *token_stream_pos(void);
+void release_consumed_input(void);
+void seek_token_stream(char *pos);
+char *edit_token_stream(int start, int end, char *text, int len, int from);
+#ifdef PARALLEL_TOKENIZE
+void tokenize_parallel(int nthreads);
+#endif
+Token *read_token(void);
+void reset_tokenizer(void);
 
 #define unreachable() \
   error("internal error at %s:%d", __FILE__, __LINE__)
 
+//
+// preprocess.c
+//
+
+void add_include_path(char *dir);
+Token *read_toplevel(void);
+char *read_position(void);
+char *last_directive_end(void);
+bool expansion_pending(void);
+void move_macros(char *old, char *old_end, char *buf);
+Token *reread_block(char *loc);
+void reset_preprocessor(void);
+
 //
 // parse.c
 //
 
 // ローカル変数
 typedef struct Obj Obj;
+typedef struct LazyBody LazyBody;
 struct Obj {
     Obj *next;
-    char *name;     // 変数名
+    char *name;     // 変数名（識別子であればインターンされている）
     Type *ty;       // 型
     bool is_local;  // ローカルまたはグローバル変数
 
@@ -86,6 +244,8 @@ struct Obj {
     Node *body;
     Obj *locals;
     int stack_size;
+    LazyBody *lazy; // 本体を読み飛ばした関数定義であれば、本体を読み直す
+                    // ための情報（parse_function_body を参照）
 };
 
 typedef enum {
@@ -115,37 +275,61 @@ typedef enum {
 } NodeKind;
 
 // 抽象構文木のノードの型
+//
+// どの種類のノードも使う共通部分の後に、種類ごとに使うメンバを共用体で
+// 重ねて置く。ノードは 64 バイトに収まり、ちょうどキャッシュラインひとつ分
+// になる。種類に合わないメンバを読み書きしてはならない。
 struct Node {
     NodeKind kind; // ノードの型
     Node *next;    // 次のstmtのノード
     Type *ty;      // 型。例えば整数型や、整数型へのポインタ型
     Token *tok;    // 表示用のトークン
 
-    Node *lhs;     // 左辺
-    Node *rhs;     // 右辺
-
-    // "if" または "for" 文
-    Node *cond;
-    Node *then;
-    Node *els;
-    Node *init;
-    Node *inc;
-
-    // ブロックまたは文式
-    Node *body;
-
-    // 構造体メンバへのアクセス
-    Member *member;
-
-    // 関数呼び出し
-    char *funcname;
-    Node *args;
-
-    Obj *var;      // kindがND_VARの場合のみ使う
-    int64_t val;   // kindがND_NUMの場合のみ使う
+    union {
+        // 演算子、式文、return 文、構造体メンバへのアクセス
+        struct {
+            Node *lhs;  // 左辺
+            union {
+                Node *rhs;      // 右辺
+                Member *member; // 構造体メンバへのアクセスの場合、そのメンバ
+            };
+        };
+
+        // "if" または "for" 文
+        struct {
+            Node *cond;
+            Node *then;
+            union {
+                Node *els;  // "if" 文
+                Node *init; // "for" 文
+            };
+            Node *inc;
+        };
+
+        // ブロックまたは文式
+        Node *body;
+
+        // 関数呼び出し
+        struct {
+            char *funcname; // インターンされた関数名
+            Node *args;
+        };
+
+        Obj *var;      // kindがND_VARの場合のみ使う
+        int64_t val;   // kindがND_NUMの場合のみ使う
+    };
 };
 
-Obj *parse(Token *tok);
+void emit_prefix(char *path);
+void use_prefix(char *path);
+Obj *parse(void (*emit_function)(Obj *fn));
+Obj *parse_retained(void);
+Obj *reparse(int start, int end, char *text, int len);
+void skip_function_bodies(void);
+Obj *parse_function_body(Obj *fn);
+void release_function_body(Obj *fn);
+void print_declarations(FILE *out);
+void reset_parser(void);
 
 //
 // type.c
@@ -164,6 +348,11 @@ typedef enum {
     TY_UNION
 } TypeKind;
 
+// 型
+//
+// ポインタ、配列、関数の型は type.c で正規化されており、構造の同じ型は
+// ひとつのオブジェクトを共有する。そのため、型が同じかどうかはポインタの
+// 比較で判定できる。変数名など宣言ごとに異なる情報は、型には持たせない。
 struct Type {
     TypeKind kind;
 
@@ -180,26 +369,24 @@ struct Type {
     // 意味する。
     Type *base;
 
-    // 宣言
-    Token *name;
-
     // 配列
     int array_len;
 
     // 構造体
     Member *members;
+    HashMap member_index; // メンバ名からメンバを引く表
 
     // 関数の型
     Type *return_ty;
-    Type *params;
-    Type *next;
+    Type **params;
+    int param_cnt;
 };
 
 // 構造体メンバ
 struct Member {
     Member *next;
     Type *ty;
-    Token *name;
+    char *name; // インターンされたメンバ名
     int offset;
 };
 
@@ -211,15 +398,27 @@ extern Type *ty_int;
 extern Type *ty_long;
 
 bool is_integer(Type *ty);
-Type *copy_type(Type *ty);
 Type *pointer_to(Type *base);
-Type *func_type(Type* return_ty);
+Type *func_type(Type *return_ty, Type **params, int param_cnt);
 Type *array_of(Type* base, int len);
 void add_type(Node *node);
+void reset_types(void);
 
 //
 // codegen.c
 //
 
-void codegen(Obj *prog, FILE *out);
-int align_to(int n, int align);
\ No newline at end of file
+void codegen_init(FILE *out);
+void codegen_function(Obj *fn);
+void codegen_data(Obj *prog);
+int align_to(int n, int align);
+
+//
+// astfile.c
+//
+
+void emit_ast_init(FILE *out);
+void emit_ast_function(Obj *fn);
+void emit_ast_data(Obj *prog);
+Obj *load_ast(char *path);
+void reset_astfile(void);
\ No newline at end of file
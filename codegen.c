@@ -19,9 +19,11 @@ static void println(char *fmt, ...) {
     fprintf(output_file, "\n");
 }
 
+// ラベルに振る通し番号
+static int label_cnt;
+
 static int count(void) {
-    static int i = 1;
-    return i++;
+    return ++label_cnt;
 }
 
 static void push(void) {
@@ -115,7 +117,7 @@ static void store(Type *ty) {
 
 // 抽象構文木にしたがって再帰的にアセンブリを出力する
 static void gen_expr(Node *node) {
-    println("  .loc 1 %d", node->tok->line_no);
+    println("  .loc %d %d", node->tok->file->file_no, node->tok->line_no);
 
     switch(node->kind) {
     case ND_NUM:
@@ -210,7 +212,7 @@ static void gen_expr(Node *node) {
 }
 
 static void gen_stmt(Node *node) {
-    println("  .loc 1 %d", node->tok->line_no);
+    println("  .loc %d %d", node->tok->file->file_no, node->tok->line_no);
 
     switch (node->kind) {
     case ND_IF: {
@@ -262,20 +264,15 @@ static void gen_stmt(Node *node) {
     error_tok(node->tok, "正しくない文です");
 }
 
-// 各ローカル変数のoffsetにオフセットを代入する
-static void assign_lvar_offsets(Obj *prog) {
-    for (Obj *fn = prog; fn; fn = fn->next) {
-        if (!fn->is_function)
-            continue;
-
-        int offset = 0;
-        for (Obj *var = fn->locals; var; var = var->next) {
-            offset += var->ty->size;
-            offset = align_to(offset, var->ty->align);
-            var->offset = -offset;
-        }
-        fn->stack_size = align_to(offset, 16);
+// 関数の各ローカル変数のoffsetにオフセットを代入する
+static void assign_lvar_offsets(Obj *fn) {
+    int offset = 0;
+    for (Obj *var = fn->locals; var; var = var->next) {
+        offset += var->ty->size;
+        offset = align_to(offset, var->ty->align);
+        var->offset = -offset;
     }
+    fn->stack_size = align_to(offset, 16);
 }
 
 static void emit_data(Obj *prog) {
@@ -314,45 +311,62 @@ static void store_gp(int r, int offset, int sz) {
     unreachable();
 }
 
-static void emit_text(Obj *prog) {
-    for (Obj *fn = prog; fn; fn = fn->next) {
-        if (!fn->is_function || !fn->is_definition)
-            continue;
+// .file を出力したファイルの数
+static int nfiles;
 
-        println("  .globl %s", fn->name);
-        println("  .text");
-        println("%s:", fn->name);
-        current_fn = fn;
-
-        // プロローグ
-        println("  push %%rbp");
-        println("  mov %%rsp, %%rbp");
-        println("  sub $%d, %%rsp", fn->stack_size);  // 関数フレームの確保
-
-        // レジスタ経由で渡された引数をスタックに保存
-        int i = 0;
-        for (Obj *var = fn->params; var; var = var->next)
-            store_gp(i++, var->offset, var->ty->size);
-
-        // コード生成
-        gen_stmt(fn->body);
-        assert(depth == 0);
-
-        // エピローグ
-        println(".L.return.%s:", fn->name);  // return文からの飛び先がここ
-        println("  mov %%rbp, %%rsp");
-        println("  pop %%rbp");
-
-        // RAX に式を計算した結果が残っているので、
-        // それをそのまま返す
-        println("  ret");
-    }
+// 入力ファイルとインクルードしたファイルに番号を振る。関数はパースした
+// そばから出力するので、まだ .file を出力していないファイルの分だけ出力する
+static void emit_files(void) {
+    File **files = get_input_files();
+    for (; files[nfiles]; nfiles++)
+        println(".file %d \"%s\"", files[nfiles]->file_no, files[nfiles]->name);
 }
 
-void codegen(Obj *prog, FILE *out) {
+// 出力先を設定する。コンパイルを繰り返す場合に備えて、通し番号も振り直す
+void codegen_init(FILE *out) {
     output_file = out;
+    label_cnt = 0;
+    nfiles = 0;
+    depth = 0;
+}
+
+// 関数定義のコードを出力する。パーサは関数をひとつパースするたびにこれを
+// 呼び、戻ったらその関数の構文木を解放する
+void codegen_function(Obj *fn) {
+    emit_files();
+    assign_lvar_offsets(fn);
+
+    println("  .globl %s", fn->name);
+    println("  .text");
+    println("%s:", fn->name);
+    current_fn = fn;
+
+    // プロローグ
+    println("  push %%rbp");
+    println("  mov %%rsp, %%rbp");
+    println("  sub $%d, %%rsp", fn->stack_size);  // 関数フレームの確保
+
+    // レジスタ経由で渡された引数をスタックに保存
+    int i = 0;
+    for (Obj *var = fn->params; var; var = var->next)
+        store_gp(i++, var->offset, var->ty->size);
+
+    // コード生成
+    gen_stmt(fn->body);
+    assert(depth == 0);
+
+    // エピローグ
+    println(".L.return.%s:", fn->name);  // return文からの飛び先がここ
+    println("  mov %%rbp, %%rsp");
+    println("  pop %%rbp");
+
+    // RAX に式を計算した結果が残っているので、
+    // それをそのまま返す
+    println("  ret");
+}
 
-    assign_lvar_offsets(prog);
+// パースし終えたら、グローバル変数と文字列リテラルを出力する
+void codegen_data(Obj *prog) {
+    emit_files();
     emit_data(prog);
-    emit_text(prog);
 }
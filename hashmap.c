@@ -0,0 +1,117 @@
+// オープンアドレス法によるハッシュテーブルの実装
+
+#include "chibicc.h"
+
+// バケットの初期サイズ
+#define INIT_SIZE 16
+
+// 使用率がこの割合（%）を超えたら再ハッシュする
+#define HIGH_WATERMARK 70
+
+// 再ハッシュ後の使用率はこの割合（%）以下に保つ
+#define LOW_WATERMARK 50
+
+static uint64_t fnv_hash(char *s, int len) {
+    uint64_t hash = 0xcbf29ce484222325;
+    for (int i = 0; i < len; i++) {
+        hash *= 0x100000001b3;
+        hash ^= (unsigned char)s[i];
+    }
+    return hash;
+}
+
+// バケットを確保する。領域から確保したバケットは、再ハッシュしても個別には
+// 解放せず、領域ごと解放する
+static HashEntry *alloc_buckets(HashMap *map, int cap) {
+    if (map->arena)
+        return arena_alloc(map->arena, sizeof(HashEntry) * cap);
+    return calloc(cap, sizeof(HashEntry));
+}
+
+// バケットを拡張し、すべてのエントリを入れ直す
+static void rehash(HashMap *map) {
+    int cap = map->capacity;
+    while ((map->used * 100) / cap >= LOW_WATERMARK)
+        cap *= 2;
+    assert(cap > 0);
+
+    HashMap map2 = {};
+    map2.buckets = alloc_buckets(map, cap);
+    map2.capacity = cap;
+    map2.arena = map->arena;
+
+    for (int i = 0; i < map->capacity; i++) {
+        HashEntry *ent = &map->buckets[i];
+        if (ent->key)
+            hashmap_put2(&map2, ent->key, ent->keylen, ent->val);
+    }
+
+    assert(map2.used == map->used);
+    if (!map->arena)
+        free(map->buckets);
+    *map = map2;
+}
+
+static bool match(HashEntry *ent, char *key, int keylen) {
+    return ent->keylen == keylen && memcmp(ent->key, key, keylen) == 0;
+}
+
+static HashEntry *get_entry(HashMap *map, char *key, int keylen) {
+    if (!map->buckets)
+        return NULL;
+
+    uint64_t hash = fnv_hash(key, keylen);
+
+    for (int i = 0; i < map->capacity; i++) {
+        HashEntry *ent = &map->buckets[(hash + i) % map->capacity];
+        if (!ent->key)
+            return NULL;
+        if (match(ent, key, keylen))
+            return ent;
+    }
+    unreachable();
+}
+
+static HashEntry *get_or_insert_entry(HashMap *map, char *key, int keylen) {
+    if (!map->buckets) {
+        map->buckets = alloc_buckets(map, INIT_SIZE);
+        map->capacity = INIT_SIZE;
+    } else if ((map->used * 100) / map->capacity >= HIGH_WATERMARK) {
+        rehash(map);
+    }
+
+    uint64_t hash = fnv_hash(key, keylen);
+
+    for (int i = 0; i < map->capacity; i++) {
+        HashEntry *ent = &map->buckets[(hash + i) % map->capacity];
+
+        if (!ent->key) {
+            ent->key = key;
+            ent->keylen = keylen;
+            map->used++;
+            return ent;
+        }
+
+        if (match(ent, key, keylen))
+            return ent;
+    }
+    unreachable();
+}
+
+void *hashmap_get(HashMap *map, char *key) {
+    return hashmap_get2(map, key, strlen(key));
+}
+
+void *hashmap_get2(HashMap *map, char *key, int keylen) {
+    HashEntry *ent = get_entry(map, key, keylen);
+    return ent ? ent->val : NULL;
+}
+
+void hashmap_put(HashMap *map, char *key, void *val) {
+    hashmap_put2(map, key, strlen(key), val);
+}
+
+void hashmap_put2(HashMap *map, char *key, int keylen, void *val) {
+    HashEntry *ent = get_or_insert_entry(map, key, keylen);
+    ent->val = val;
+}
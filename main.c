@@ -2,13 +2,70 @@
 
 static char *opt_o;
 
+#ifdef PARALLEL_TOKENIZE
+// トークナイズに使うスレッドの数。複数のスレッドで速くなることはまだ
+// 確かめられていないので、既定では逐次的にトークナイズする（実験的な機能）
+static int opt_j = 1;
+#endif
+
+// 依存関係をMakefileの形式で出力する（-MD）
+static bool opt_MD;
+static char *opt_MF;
+
+// 共通のプリフィックスのスナップショットを書き出す、あるいは読み込む
+static char *opt_emit_prefix;
+static char *opt_use_prefix;
+
+// 関数の本体を読み飛ばし、ファイルスコープの宣言の一覧を出力する
+static bool opt_declarations_only;
+
+// 関数の本体を読み飛ばしてパースし、コードを生成する直前に本体を読み直す
+static bool opt_lazy_bodies;
+
+// パースした結果を AST ファイルに書き出す（--emit-ast）。あるいは、入力を
+// C のソースではなく AST ファイルとして読み込む（--load-ast）
+static bool opt_emit_ast;
+static bool opt_load_ast;
+
+// パースした後で入力ファイルに適用する編集（--edit）。増分パースを使う
+typedef struct {
+    int start;
+    int end;
+    char *text;
+} Edit;
+
+static Edit *opt_edits;
+static int opt_edits_cnt;
+
 static char *input_path;
 
 static void usage(int status) {
-    fprintf(stderr, "chibicc [ -o <path> ] <file>\n");
+    fprintf(stderr, "chibicc [ -o <path> ] [ -I<dir> ] [ -MD ] [ -MF <path> ]\n"
+            "        [ --emit-prefix <path> | --use-prefix <path> ]\n"
+            "        [ --declarations-only | --lazy-bodies ]\n"
+            "        [ -fmax-errors=<n> ] [ --edit <start>,<end>,<text> ]...\n"
+            "        [ --emit-ast | --load-ast ] <file>\n");
+#ifdef PARALLEL_TOKENIZE
+    fprintf(stderr, "\n  -j <threads>  tokenize with <threads> threads (experimental; default 1)\n");
+#endif
     exit(status);
 }
 
+// "<start>,<end>,<text>" の形の編集を加える。入力ファイルの [start, end)
+// バイト目を text で置き換える
+static void add_edit(char *arg) {
+    char *p;
+    int start = strtol(arg, &p, 10);
+    if (*p != ',')
+        error("不正な編集です: %s", arg);
+    int end = strtol(p + 1, &p, 10);
+    if (*p != ',')
+        error("不正な編集です: %s", arg);
+
+    opt_edits = realloc(opt_edits, sizeof(Edit) * (opt_edits_cnt + 1));
+    opt_edits[opt_edits_cnt++] = (Edit){start, end, p + 1};
+}
+
 static void parse_args(int argc, char **argv) {
     for (int i = 0; i < argc; i++) {
         if (!strcmp(argv[i], "--help"))
@@ -26,6 +83,93 @@ static void parse_args(int argc, char **argv) {
             continue;
         }
 
+#ifdef PARALLEL_TOKENIZE
+        if (!strcmp(argv[i], "-j")) {
+            if (!argv[++i])
+                usage(1);
+            opt_j = atoi(argv[i]);
+            continue;
+        }
+
+        if (!strncmp(argv[i], "-j", 2)) {
+            opt_j = atoi(argv[i] + 2);
+            continue;
+        }
+#endif
+
+        if (!strcmp(argv[i], "-I")) {
+            if (!argv[++i])
+                usage(1);
+            add_include_path(argv[i]);
+            continue;
+        }
+
+        if (!strncmp(argv[i], "-I", 2)) {
+            add_include_path(argv[i] + 2);
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-MD")) {
+            opt_MD = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "-MF")) {
+            if (!argv[++i])
+                usage(1);
+            opt_MF = argv[i];
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--emit-prefix")) {
+            if (!argv[++i])
+                usage(1);
+            opt_emit_prefix = argv[i];
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--use-prefix")) {
+            if (!argv[++i])
+                usage(1);
+            opt_use_prefix = argv[i];
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--declarations-only")) {
+            opt_declarations_only = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--lazy-bodies")) {
+            opt_lazy_bodies = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--emit-ast")) {
+            opt_emit_ast = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--load-ast")) {
+            opt_load_ast = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--edit")) {
+            if (!argv[++i])
+                usage(1);
+            add_edit(argv[i]);
+            continue;
+        }
+
+        // 報告するエラーの数の上限。0 なら上限なし
+        if (!strncmp(argv[i], "-fmax-errors=", 13)) {
+            max_errors = atoi(argv[i] + 13);
+            if (max_errors < 0)
+                error("エラーの数の上限が正しくありません: %d", max_errors);
+            continue;
+        }
+
         if (argv[i][0] == '-' && argv[i][1] != '\0')
             error("不正な引数です: %s", argv[i]);
 
@@ -34,30 +178,209 @@ static void parse_args(int argc, char **argv) {
 
     if (!input_path)
         error("入力元ファイルがありません");
+
+#ifdef PARALLEL_TOKENIZE
+    if (opt_j < 1)
+        error("スレッドの数が正しくありません: %d", opt_j);
+#endif
+}
+
+// 書き出し中の出力先ファイル。コンパイルに失敗したときに不完全な出力を
+// 残さないよう、出力先と同じディレクトリの一時ファイルに書き出しておき、
+// 成功してから名前を付け替える。error() で終了した場合は一時ファイルを消す
+static char *output_tmp;
+
+static void remove_output_tmp(void) {
+    if (output_tmp)
+        unlink(output_tmp);
 }
 
-static FILE *open_file(char *path) {
-    if (!path || strcmp(path, "-") == 0)
+static FILE *open_output(void) {
+    if (!opt_o || strcmp(opt_o, "-") == 0)
         return stdout;
 
+    output_tmp = format("%s.tmpXXXXXX", opt_o);
+    int fd = mkstemp(output_tmp);
+    if (fd == -1)
+        error("出力先ファイルを開けませんでした: %s: %s", opt_o, strerror(errno));
+    atexit(remove_output_tmp);
+
+    // mkstemp は所有者だけが読み書きできるファイルを作るので、fopen で
+    // 作った場合と同じパーミッションにする
+    mode_t mask = umask(0);
+    umask(mask);
+    fchmod(fd, 0666 & ~mask);
+    return fdopen(fd, "w");
+}
+
+// 出力を書き終えたら、一時ファイルを出力先ファイルの名前に付け替える
+static void close_output(FILE *out) {
+    if (out == stdout)
+        return;
+    if (fclose(out) || rename(output_tmp, opt_o))
+        error("出力先ファイルに書き込めませんでした: %s: %s", opt_o, strerror(errno));
+    output_tmp = NULL;
+}
+
+// パスの拡張子を付け替える。拡張子がなければ付け加える
+static char *replace_extn(char *path, char *extn) {
+    char *dot = strrchr(path, '.');
+    char *slash = strrchr(path, '/');
+    if (!dot || (slash && dot < slash))
+        return format("%s%s", path, extn);
+    return format("%.*s%s", (int)(dot - path), path, extn);
+}
+
+// 入力ファイルとインクルードしたファイルを、出力の依存関係として書き出す
+static void write_dependencies(void) {
+    char *target = opt_o ? opt_o : replace_extn(input_path, ".s");
+    char *path = opt_MF ? opt_MF : replace_extn(target, ".d");
+
     FILE *out = fopen(path, "w");
     if (!out)
-        error("出力先ファイルを開けませんでした: %s: %s", path, strerror(errno));
-    return out;
+        error("依存関係の出力先ファイルを開けませんでした: %s: %s", path, strerror(errno));
+
+    fprintf(out, "%s:", target);
+    File **files = get_input_files();
+    for (int i = 0; files[i]; i++)
+        fprintf(out, " \\\n  %s", files[i]->name);
+    fprintf(out, "\n");
+    fclose(out);
+}
+
+// 関数定義を、入力ファイルに現れた順にコード生成に渡す。`prog` は
+// 新しいものが先頭のリストなので、逆順にたどる。`lazy` が真であれば、
+// 読み飛ばした本体をコードを生成する直前にパースし、生成し終えたら解放する。
+// 本体の文字列リテラルを加えたグローバル変数のリストを返す
+static Obj *emit_functions(Obj *prog, bool lazy) {
+    int cnt = 0;
+    for (Obj *var = prog; var; var = var->next)
+        if (var->is_function && var->is_definition)
+            cnt++;
+
+    Obj **fns = calloc(cnt + 1, sizeof(Obj *));
+    int i = cnt;
+    for (Obj *var = prog; var; var = var->next)
+        if (var->is_function && var->is_definition)
+            fns[--i] = var;
+    Obj *globals = prog;
+    for (i = 0; i < cnt; i++) {
+        Obj *fn = fns[i];
+        if (lazy && !(globals = parse_function_body(fn)))
+            error("関数 %s の本体を読み直せません", fn->name);
+        codegen_function(fn);
+        if (lazy) {
+            release_function_body(fn);
+            arena_release(&ast_arena);
+        }
+    }
+    free(fns);
+    return globals;
 }
 
 int main(int argc, char **argv) {
     parse_args(argc, argv);
 
-    // トークナイズする
-    Token *tok = tokenize_file(input_path);
+    // AST ファイルを読み込む場合は、トークナイズもパースもせずにコードを生成する
+    if (opt_load_ast) {
+        Obj *prog = load_ast(input_path);
+        FILE *out = open_output();
+        codegen_init(out);
+        emit_functions(prog, false);
+        codegen_data(prog);
+        close_output(out);
+        return 0;
+    }
+
+    // 入力ファイルを開く。トークナイズはパーサの求めに応じて少しずつ行う
+    open_token_stream(input_path);
+
+#ifdef PARALLEL_TOKENIZE
+    // 複数のスレッドを使う場合は、入力全体を先に並列でトークナイズしておく
+    // 増分パースは宣言の区切りの位置を使うので、先にトークナイズしてはならない
+    if (opt_j > 1 && !opt_edits_cnt)
+        tokenize_parallel(opt_j);
+#endif
+
+    // スナップショットを書き出す場合は、パースするだけでアセンブリは出力しない
+    if (opt_use_prefix)
+        use_prefix(opt_use_prefix);
+    if (opt_emit_prefix) {
+        emit_prefix(opt_emit_prefix);
+        parse(NULL);
+        return 0;
+    }
+
+    // 宣言の一覧だけを出力する場合は、関数の本体はパースしない
+    if (opt_declarations_only) {
+        skip_function_bodies();
+        parse(NULL);
+        FILE *out = open_output();
+        print_declarations(out);
+        close_output(out);
+        if (opt_MD)
+            write_dependencies();
+        return 0;
+    }
+
+    // 関数の本体を読み飛ばしてパースしておき、コードを生成する直前に
+    // 一つずつ読み直す。本体を必要なときだけパースするツールと同じ使い方
+    if (opt_lazy_bodies) {
+        skip_function_bodies();
+        Obj *prog = parse(NULL);
+        FILE *out = open_output();
+        codegen_init(out);
+        prog = emit_functions(prog, true);
+        codegen_data(prog);
+        close_output(out);
+        if (opt_MD)
+            write_dependencies();
+        return 0;
+    }
+
+    // 編集を適用する場合は、入力全体をパースしておいてから編集ごとに
+    // パースし直し、最後の結果からアセンブリを出力する
+    if (opt_edits_cnt) {
+        Obj *prog = parse_retained();
+        for (int i = 0; i < opt_edits_cnt; i++) {
+            Edit *e = &opt_edits[i];
+            prog = reparse(e->start, e->end, e->text, strlen(e->text));
+            if (!prog)
+                error("%d番目の編集は増分パースできません", i + 1);
+        }
+        if (error_cnt)
+            exit(1);
+        FILE *out = open_output();
+        codegen_init(out);
+        emit_functions(prog, false);
+        codegen_data(prog);
+        close_output(out);
+        if (opt_MD)
+            write_dependencies();
+        return 0;
+    }
+
+    // AST ファイルに書き出す場合も、関数ごとにパースしたそばからレコードにする
+    if (opt_emit_ast) {
+        FILE *out = open_output();
+        emit_ast_init(out);
+        Obj *prog = parse(emit_ast_function);
+        emit_ast_data(prog);
+        close_output(out);
+        if (opt_MD)
+            write_dependencies();
+        return 0;
+    }
 
-    // パースする
-    Obj *prog = parse(tok);
+    // パースしながら、関数ごとにASTを走査してアセンブリを出力する。
+    // グローバル変数は、すべてパースし終えてから出力する
+    FILE *out = open_output();
+    codegen_init(out);
+    Obj *prog = parse(codegen_function);
+    codegen_data(prog);
+    close_output(out);
 
-    // ASTを走査してアセンブリを出力する
-    FILE *out = open_file(opt_o);
-    fprintf(out, ".file 1 \"%s\"\n", input_path);
-    codegen(prog, out);
+    if (opt_MD)
+        write_dependencies();
     return 0;
 }
@@ -3,7 +3,8 @@
 // ローカル・グローバル変数または typedef のためのスコープ
 typedef struct VarScope VarScope;
 struct VarScope {
-    VarScope *next;
+    VarScope *next;   // 同じブロックスコープで宣言された次の名前
+    VarScope *shadow; // この宣言が隠している外側の同名の宣言
     char *name;
     Obj *var;
     Type *type_def;
@@ -12,7 +13,8 @@ struct VarScope {
 // 構造体タグのためのスコープ
 typedef struct TagScope TagScope;
 struct TagScope {
-    TagScope *next;
+    TagScope *next;   // 同じブロックスコープで宣言された次のタグ
+    TagScope *shadow; // この宣言が隠している外側の同名のタグ
     char *name;
     Type *ty;
 };
@@ -24,15 +26,28 @@ struct Scope {
 
     // C は２つのブロックスコープを持っている。一つは変数のための。
     // もう一つは構造体タグのためのものである。
+    // スコープを抜けるときに取り除けるよう、このスコープで宣言したものを並べておく。
     VarScope *vars;
     TagScope *tags;
 };
 
+// 名前から現在見えている宣言を引くには、インターンした識別子の束縛
+// （Binding）を使う。束縛は最も内側の宣言を指し、外側の宣言は shadow で
+// たどれる。宣言するときに積み、スコープを抜けるときに外側の宣言に戻すので、
+// スコープがいくら深くても、宣言がいくら多くても、探索は定数時間で済む。
+
 // typedef や extern といった変数の属性
 typedef struct {
     bool is_typedef;
 } VarAttr;
 
+// 宣言子から分かる、型以外の情報。型は構造ごとに共有されるので、
+// 宣言ごとに異なる名前は型ではなくこちらに持つ。
+typedef struct {
+    Token *name;    // 宣言された識別子
+    Token **params; // 関数の宣言子であれば、仮引数の名前
+} Decl;
+
 // パースしている間に作成されたすべてのローカル変数インスタンスは
 // このスタックに積み重ねられていく
 static Obj *locals;
@@ -42,49 +57,83 @@ static Obj *globals;
 
 static Scope *scope = &(Scope){};
 
+// ノード、ローカル変数、スコープを確保する領域。関数の本体をパースしている
+// 間は body_arena で、ファイルスコープでは file_arena である。型と構造体の
+// メンバは、ブロックの中で宣言されたものを含めて perm_arena から確保する
+// （正規化した派生型から参照されるため）。
+static Arena *fn_arena = &perm_arena;
+
+// ファイルスコープの宣言（グローバル変数とそのスコープ）の領域。ずっと
+// 使うので perm_arena だが、増分パースではトップレベルの宣言ごとに分ける
+static Arena *file_arena = &perm_arena;
+
+// 関数の本体の領域。ast_arena はコードを生成したら解放される。増分パース
+// では関数ごとに分け、本体をパースし直すときに解放する
+static Arena *body_arena = &ast_arena;
+
+// 真であれば、関数の本体をパースせずに読み飛ばす（--declarations-only）
+static bool skip_bodies;
+
+// 読み飛ばした関数の本体。トークンは保持せずに入力ファイル中の位置だけを
+// 覚えておき、parse_function_body で読み直す
+struct LazyBody {
+    char *loc;          // 本体を始める "{" の位置
+    uint64_t hash;      // 読み飛ばしたときの本体のトークンのハッシュ値
+    char **param_names; // 仮引数の名前
+    Token *tok;         // 読み直した本体のトークン
+};
+
+// エラーから回復したときに戻すパーサの状態
+typedef struct {
+    Scope *scope;
+    int operands_len;
+    int operators_len;
+} ParserState;
+
+static ParserState save_state(void);
+static void restore_state(ParserState state);
+
 // スコープに入る
 static void enter_scope(void) {
-    Scope *sc = calloc(1, sizeof(Scope));
+    Scope *sc = arena_alloc(fn_arena, sizeof(Scope));
     sc->next = scope;
     scope = sc;
 }
 
-// スコープを抜ける
+// スコープを抜ける。このスコープで宣言した名前は、隠していた外側の宣言に戻す
 static void leave_scope(void) {
+    for (VarScope *sc = scope->vars; sc; sc = sc->next)
+        get_binding(sc->name)->var = sc->shadow;
+    for (TagScope *sc = scope->tags; sc; sc = sc->next)
+        get_binding(sc->name)->tag = sc->shadow;
     scope = scope->next;
 }
 
 // ローカル変数を名前によって探す
 static VarScope *find_var(Token *tok) {
-    for (Scope *sc = scope; sc; sc = sc->next)
-        for (VarScope *sc2 = sc->vars; sc2; sc2 = sc2->next)
-            if (equal(tok, sc2->name))
-                return sc2;
-    return NULL;
+    return tok->kind == TK_IDENT ? get_binding(tok->str)->var : NULL;
 }
 
 // 構造体タグを名前によって探す
 static Type *find_tag(Token *tok) {
-    for (Scope *sc = scope; sc; sc = sc->next)
-        for (TagScope *sc2 = sc->tags; sc2; sc2 = sc2->next)
-            if (equal(tok, sc2->name))
-                return sc2->ty;
-    return NULL;
+    TagScope *sc = tok->kind == TK_IDENT ? get_binding(tok->str)->tag : NULL;
+    return sc ? sc->ty : NULL;
 }
 
 // メモリの確保と、指定された種類のノードの作成
 static Node *new_node(NodeKind kind, Token *tok) {
-    Node *node = calloc(1, sizeof(Node));
+    Node *node = arena_alloc(fn_arena, sizeof(Node));
     node->kind = kind;
     node->tok = tok;
     return node;
 }
 
-// 新しい二項演算子のノードを作成する
+// 新しい二項演算子のノードを作成する。式のノードは作成した時点で型がつく
 static Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok) {
     Node *node = new_node(kind, tok);
     node->lhs = lhs;
     node->rhs = rhs;
+    add_type(node);
     return node;
 }
 
@@ -92,6 +141,7 @@ static Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok) {
 static Node *new_unary(NodeKind kind, Node *expr, Token *tok) {
     Node *node = new_node(kind, tok);
     node->lhs = expr;
+    add_type(node);
     return node;
 }
 
@@ -99,6 +149,7 @@ static Node *new_unary(NodeKind kind, Node *expr, Token *tok) {
 static Node *new_num(int64_t val, Token *tok) {
     Node *node = new_node(ND_NUM, tok);
     node->val = val;
+    add_type(node);
     return node;
 }
 
@@ -106,21 +157,38 @@ static Node *new_num(int64_t val, Token *tok) {
 static Node *new_var_node(Obj *var, Token *tok) {
     Node *node = new_node(ND_VAR, tok);
     node->var = var;
+    add_type(node);
     return node;
 }
 
+// 宣言を現在のスコープに加え、同名の外側の宣言を隠す
+static void bind_var(VarScope *sc) {
+    Binding *b = get_binding(sc->name);
+    sc->shadow = b->var;
+    b->var = sc;
+    sc->next = scope->vars;
+    scope->vars = sc;
+}
+
+static void bind_tag(TagScope *sc) {
+    Binding *b = get_binding(sc->name);
+    sc->shadow = b->tag;
+    b->tag = sc;
+    sc->next = scope->tags;
+    scope->tags = sc;
+}
+
 // 現在のスコープの変数スタックに新しい変数をプッシュする
 static VarScope *push_scope(char *name) {
-    VarScope *sc = calloc(1, sizeof(VarScope));
+    VarScope *sc = arena_alloc(fn_arena, sizeof(VarScope));
     sc->name = name;
-    sc->next = scope->vars;
-    scope->vars = sc;
+    bind_var(sc);
     return sc;
 }
 
 // 新しい変数を作成する
-static Obj *new_var(char *name, Type *ty) {
-    Obj *var = calloc(1, sizeof(Obj));
+static Obj *new_var(char *name, Type *ty, Arena *arena) {
+    Obj *var = arena_alloc(arena, sizeof(Obj));
     var->name = name;
     var->ty = ty;
     push_scope(name)->var = var;
@@ -129,7 +197,7 @@ static Obj *new_var(char *name, Type *ty) {
 
 // 新しいローカル変数を作成する
 static Obj *new_lvar(char *name, Type *ty) {
-    Obj *var = new_var(name, ty);
+    Obj *var = new_var(name, ty, fn_arena);
     var->is_local = true;
     var->name = name;
     var->ty = ty;
@@ -140,15 +208,21 @@ static Obj *new_lvar(char *name, Type *ty) {
 
 // 新しいグローバル変数を作成する
 static Obj *new_gvar(char *name, Type *ty) {
-    Obj *var = new_var(name, ty);
+    Obj *var = new_var(name, ty, file_arena);
     var->next = globals;
     globals = var;
     return var;
 }
 
+// 無名のグローバル変数に振る通し番号
+static int unique_id;
+
+// 名前は束縛を持てるようにインターンしておく
 static char *new_unique_name(void) {
-    static int id = 0;
-    return format(".L..%d", id++);
+    char *name = format(".L..%d", unique_id++);
+    char *atom = intern(name, strlen(name));
+    free(name);
+    return atom;
 }
 
 static Obj *new_anon_gvar(Type *ty) {
@@ -161,20 +235,16 @@ static Obj *new_string_literal(char *p, Type *ty) {
     return var;
 }
 
-// 識別子のトークンから識別子の文字列を得る
+// 識別子のトークンからインターンされた識別子の文字列を得る
 static char *get_ident(Token *tok) {
     if (tok->kind != TK_IDENT)
         error_tok(tok, "トークンの種類が識別子である必要があります");
-    return strndup(tok->loc, tok->len);
+    return tok->str;
 }
 
 static Type *find_typedef(Token *tok) {
-    if (tok->kind == TK_IDENT) {
-        VarScope *sc = find_var(tok);
-        if (sc)
-            return sc->type_def;
-    }
-    return NULL;
+    VarScope *sc = find_var(tok);
+    return sc ? sc->type_def : NULL;
 }
 
 // 数値のトークンから数値を得る
@@ -184,36 +254,27 @@ static int get_number(Token *tok) {
     return tok->val;
 }
 
+static uint64_t hash_tokens(Token *tok, Token *end);
 static Node *stmt(Token **rest, Token *tok);
 static Node *compound_stmt(Token **rest, Token *tok);
 static Type *declspec(Token **rest, Token *tok, VarAttr *attr);
-static Type *declarator(Token **rest, Token *tok, Type* ty);
+static Type *declarator(Token **rest, Token *tok, Type *ty, Decl *decl);
 static Node *declaration(Token **rest, Token *tok, Type *basety);
 static Node *expr_stmt(Token **rest, Token *tok);
 static Node *assign(Token **rest, Token *tok);
 static Node *expr(Token **rest, Token *tok);
-static Node *equality(Token **rest, Token *tok);
-static Node *relational(Token **rest, Token *tok);
-static Node *add(Token **rest, Token *tok);
-static Node *mul(Token **rest, Token *tok);
 static Type *struct_decl(Token **rest, Token *tok);
 static Type *union_decl(Token **rest, Token *tok);
 static Node *postfix(Token **rest, Token *tok);
-static Node *unary(Token **rest, Token *tok);
+static Node *postfix_suffix(Token **rest, Token *tok, Node *node);
 static Node *primary(Token **rest, Token *tok);
 static Token *parse_typedef(Token *tok, Type *basety);
 
-// 与えられたトークンが型を表している場合、trueを返す
+// 与えられたトークンが型を表している場合、trueを返す。
+// キーワードかどうかはトークナイズしたときに分かっており、識別子が
+// typedef 名かどうかは識別子の束縛を見ればすぐに分かる。
 static bool is_typename(Token *tok) {
-    static char *kw[] = {
-        "void", "char", "short", "int", "long", "struct", "union",
-        "typedef"
-    };
-
-    for (int i = 0; i < sizeof(kw) / sizeof(*kw); i++)
-        if (equal(tok, kw[i]))
-            return true;
-    return find_typedef(tok);
+    return tok->is_typespec || find_typedef(tok);
 }
 
 // stmtをパースする
@@ -224,69 +285,124 @@ static bool is_typename(Token *tok) {
 //      | "{" compund-stmt
 //      | expr-stmt
 static Node *stmt(Token **rest, Token *tok) {
-    if (equal(tok, "return")) {
-        Node *node = new_node(ND_RETURN, tok);
+    Node *node;
+
+    switch (tok->id) {
+    case KW_RETURN:
+        node = new_node(ND_RETURN, tok);
         node->lhs = expr(&tok, tok->next);
         *rest = skip(tok, ";");
         return node;
-    }
 
-    if (equal(tok, "if")) {
-        Node *node = new_node(ND_IF, tok);
+    case KW_IF:
+        node = new_node(ND_IF, tok);
         tok = skip(tok->next, "(");
         node->cond = expr(&tok, tok);
         tok = skip(tok, ")");
         node->then = stmt(&tok, tok);
-        if (equal(tok, "else"))
+        if (tok->id == KW_ELSE)
             node->els = stmt(&tok, tok->next);
         *rest = tok;
         return node;
-    }
 
-    if (equal(tok, "for")) {
-        Node *node = new_node(ND_FOR, tok);
+    case KW_FOR:
+        node = new_node(ND_FOR, tok);
         tok = skip(tok->next, "(");
 
         node->init = expr_stmt(&tok, tok);
 
-        if (!equal(tok, ";"))
+        if (tok->id != ';')
             node->cond = expr(&tok, tok);
         tok = skip(tok, ";");
 
-        if (!equal(tok, ")"))
+        if (tok->id != ')')
             node->inc = expr(&tok, tok);
         tok = skip(tok, ")");
 
         node->then = stmt(rest, tok);
         return node;
-    }
 
-    if (equal(tok, "while")) {
-        Node *node = new_node(ND_FOR, tok);
+    case KW_WHILE:
+        node = new_node(ND_FOR, tok);
         tok = skip(tok->next, "(");
         node->cond = expr(&tok, tok);
         tok = skip(tok, ")");
         node->then = stmt(rest, tok);
         return node;
-    }
 
-    if (equal(tok, "{"))
+    case '{':
         return compound_stmt(rest, tok->next);
 
-    return expr_stmt(rest, tok);
+    default:
+        return expr_stmt(rest, tok);
+    }
+}
+
+// エラーが起きた文を読み飛ばし、次の文の先頭を返す。文は括弧の外の ";" か、
+// 文の中で開いたブロックを閉じる "}" で終わる。文を含むブロックを閉じる "}"
+// と入力の終わりでは、そのトークンで止まる。
+static Token *synchronize(Token *tok) {
+    int braces = 0;
+    int parens = 0;
+
+    for (; tok->kind != TK_EOF; tok = tok->next) {
+        switch (tok->id) {
+        case '(':
+            parens++;
+            break;
+        case ')':
+            if (parens)
+                parens--;
+            break;
+        case '{':
+            braces++;
+            break;
+        case '}':
+            if (braces == 0)
+                return tok;
+            if (--braces == 0 && parens == 0)
+                return tok->next;
+            break;
+        case ';':
+            if (braces == 0 && parens == 0)
+                return tok->next;
+            break;
+        }
+    }
+    return tok;
 }
 
 // compound-stmtをパースする
 // compound-stmt = (typedef | declaration | stmt)* "}"
+//
+// 文の途中でエラーが起きたら、その文を読み飛ばして次の文からパースを続ける
 static Node *compound_stmt(Token **rest, Token *tok) {
     Node *node = new_node(ND_BLOCK, tok);
 
     Node head = {};
-    Node *cur = &head;
+    Node *volatile cur = &head;
 
     enter_scope();
 
-    while (!equal(tok, "}")) {
+    // エラーが起きたら、パース中だった文 `start` を読み飛ばして続ける
+    jmp_buf jmp;
+    jmp_buf *outer = error_recovery;
+    ParserState state = save_state();
+    Token *volatile start = tok;
+    if (setjmp(jmp)) {
+        restore_state(state);
+        tok = synchronize(start);
+    }
+    error_recovery = &jmp;
+
+    while (tok->id != '}') {
+        start = tok;
+
+        if (tok->kind == TK_EOF) {
+            error_recovery = outer;
+            error_tok(tok, "記号 '}' が必要です");
+        }
+
         if (is_typename(tok)) {
             VarAttr attr = {};
             Type *basety = declspec(&tok, tok, &attr);
@@ -300,9 +416,9 @@ static Node *compound_stmt(Token **rest, Token *tok) {
         } else {
             cur = cur->next = stmt(&tok, tok);
         }
-        add_type(cur);
     }
 
+    error_recovery = outer;
     leave_scope();
 
     node->body = head.next;
@@ -312,11 +428,10 @@ static Node *compound_stmt(Token **rest, Token *tok) {
 
 // 新しい TagScope を現在のスコープにプッシュする
 static void push_tag_scope(Token *tok, Type *ty) {
-    TagScope *sc = calloc(1, sizeof(TagScope));
-    sc->name = strndup(tok->loc, tok->len);
+    TagScope *sc = arena_alloc(fn_arena, sizeof(TagScope));
+    sc->name = tok->str;
     sc->ty = ty;
-    sc->next = scope->tags;
-    scope->tags = sc;
+    bind_tag(sc);
 }
 
 // declspecをパースする
@@ -350,47 +465,53 @@ static Type *declspec(Token **rest, Token *tok, VarAttr *attr) {
     int counter = 0;
 
     while (is_typename(tok)) {
+        // ユーザー定義型は他の型名と組み合わせられないので、すでに型名が
+        // あれば、これは型指定子の一部ではない（例えば typedef 名の再宣言）
+        bool is_user = tok->id == KW_STRUCT || tok->id == KW_UNION || !tok->is_typespec;
+        if (is_user && counter)
+            break;
+
+        switch (tok->id) {
         // "typedef" キーワードを扱う
-        if (equal(tok, "typedef")) {
+        case KW_TYPEDEF:
             if (!attr)
                 error_tok(tok, "このコンテキストではストレージクラス指定子は許可されていません");
             attr->is_typedef = true;
             tok = tok->next;
             continue;
-        }
 
         // ユーザー定義型を扱う
-        Type *ty2 = find_typedef(tok);
-        if (equal(tok, "struct") || equal(tok, "union") || ty2) {
-            if (counter)
-                break;
-
-            if (equal(tok, "struct")) {
-                ty = struct_decl(&tok, tok->next);
-            } else if (equal(tok, "union")) {
-                ty = union_decl(&tok, tok->next);
-            } else {
-                ty = ty2;
-                tok = tok->next;
-            }
-
+        case KW_STRUCT:
+            ty = struct_decl(&tok, tok->next);
+            counter += OTHER;
+            continue;
+        case KW_UNION:
+            ty = union_decl(&tok, tok->next);
+            counter += OTHER;
+            continue;
+        default:
+            ty = find_typedef(tok);
+            tok = tok->next;
             counter += OTHER;
             continue;
-        }
 
         // 組み込み型を扱う
-        if (equal(tok, "void"))
+        case KW_VOID:
             counter += VOID;
-        else if (equal(tok, "char"))
+            break;
+        case KW_CHAR:
             counter += CHAR;
-        else if (equal(tok, "short"))
+            break;
+        case KW_SHORT:
             counter += SHORT;
-        else if (equal(tok, "int"))
+            break;
+        case KW_INT:
             counter += INT;
-        else if (equal(tok, "long"))
+            break;
+        case KW_LONG:
             counter += LONG;
-        else
-            unreachable();
+            break;
+        }
 
         switch (counter) {
         case VOID:
@@ -426,20 +547,31 @@ static Type *declspec(Token **rest, Token *tok, VarAttr *attr) {
 // func-paramsをパースする
 // func-params = (param ("," param)*)? ")"
 // param       = declspec declarator
-static Type *func_params(Token **rest, Token *tok, Type *ty) {
-    Type head = {};
-    Type *cur = &head;
-
-    while (!equal(tok, ")")) {
-        if (cur != &head)
+//
+// 仮引数の名前は `decl` があればそこに記録する。名前の配列は関数の本体と
+// 同じ領域に置く（仮引数のローカル変数を作るまで使えればよい）
+static Type *func_params(Token **rest, Token *tok, Type *ty, Decl *decl) {
+    Type **params = NULL;
+    Token **names = NULL;
+    int cnt = 0;
+
+    while (tok->id != ')') {
+        if (cnt)
             tok = skip(tok, ",");
         Type *basety = declspec(&tok, tok, NULL);
-        Type *ty = declarator(&tok, tok, basety);
-        cur = cur->next = copy_type(ty);
+        Decl param = {};
+        params = realloc(params, sizeof(Type *) * (cnt + 1));
+        names = realloc(names, sizeof(Token *) * (cnt + 1));
+        params[cnt] = declarator(&tok, tok, basety, &param);
+        names[cnt++] = param.name;
     }
 
-    ty = func_type(ty);
-    ty->params = head.next;
+    ty = func_type(ty, params, cnt);
+    free(params);
+    if (decl && cnt)
+        decl->params = memcpy(arena_alloc(body_arena, sizeof(Token *) * cnt), names,
+                              sizeof(Token *) * cnt);
+    free(names);
     *rest = tok->next;
     return ty;
 }
@@ -448,14 +580,14 @@ static Type *func_params(Token **rest, Token *tok, Type *ty) {
 // type-suffix = ("(" func-params
 //             | "[" num "]" type-suffix
 //             | ε
-static Type *type_suffix(Token **rest, Token *tok, Type *ty) {
-    if (equal(tok, "("))
-        return func_params(rest, tok->next, ty);
+static Type *type_suffix(Token **rest, Token *tok, Type *ty, Decl *decl) {
+    if (tok->id == '(')
+        return func_params(rest, tok->next, ty, decl);
 
-    if (equal(tok, "[")) {
+    if (tok->id == '[') {
         int sz = get_number(tok->next);
         tok = skip(tok->next->next, "]");
-        ty = type_suffix(rest, tok, ty);
+        ty = type_suffix(rest, tok, ty, decl);
         return array_of(ty, sz);
     }
 
@@ -463,47 +595,62 @@ static Type *type_suffix(Token **rest, Token *tok, Type *ty) {
     return ty;
 }
 
+// "(" から対応する ")" までを読み飛ばし、その次のトークンを返す。
+// 括弧の中はパースしない。
+static Token *skip_paren(Token *tok) {
+    int depth = 0;
+    for (;; tok = tok->next) {
+        if (tok->kind == TK_EOF)
+            error_tok(tok, "記号 ')' が必要です");
+        if (tok->id == '(')
+            depth++;
+        else if (tok->id == ')' && --depth == 0)
+            return tok->next;
+    }
+}
+
 // declaratorをパースする
 // declarator = "*"* ("(" ident ")" | "(" declarator ")" | ident ) type-suffix
-static Type *declarator(Token **rest, Token *tok, Type *ty) {
-    while (consume(&tok, tok, "*"))
+//
+// 括弧で囲まれた宣言子の型は、括弧の後ろの type-suffix を適用した型から
+// 組み立てる。そこで、括弧の中は先に読み飛ばして type-suffix を読み、
+// それから括弧の中を一度だけパースする。
+//
+// 宣言された名前は、型ではなく `decl` に記録する
+static Type *declarator(Token **rest, Token *tok, Type *ty, Decl *decl) {
+    for (; tok->id == '*'; tok = tok->next)
         ty = pointer_to(ty);
 
-    if (equal(tok, "(")) {
+    if (tok->id == '(') {
         Token *start = tok;
-        Type dummy = {};
-        declarator(&tok, start->next, &dummy);
-        tok = skip(tok, ")");
-        ty = type_suffix(rest, tok, ty);
-        return declarator(&tok, start->next, ty);
+        ty = type_suffix(rest, skip_paren(start), ty, decl);
+        ty = declarator(&tok, start->next, ty, decl);
+        skip(tok, ")");
+        return ty;
     }
 
     if (tok->kind != TK_IDENT)
         error_tok(tok, "変数名がありません");
 
-    ty = type_suffix(rest, tok->next, ty);
-    ty->name = tok;
-    return ty;
+    decl->name = tok;
+    return type_suffix(rest, tok->next, ty, decl);
 }
 
 // abstract-declaratorをパースする
 // abstract-declarator = "*"* ("(" abstract-declarator ")")? type-suffix
 static Type *abstract_declarator(Token **rest, Token *tok, Type *ty) {
-    while (equal(tok, "*")) {
+    for (; tok->id == '*'; tok = tok->next)
         ty = pointer_to(ty);
-        tok = tok->next;
-    }
 
-    if (equal(tok, "(")) {
+    if (tok->id == '(') {
         Token *start = tok;
-        Type dummy = {};
-        abstract_declarator(&tok, start->next, &dummy);
-        tok = skip(tok, ")");
-        ty = type_suffix(rest, tok, ty);
-        return abstract_declarator(&tok, start->next, ty);
+        ty = type_suffix(rest, skip_paren(start), ty, NULL);
+        ty = abstract_declarator(&tok, start->next, ty);
+        skip(tok, ")");
+        return ty;
     }
 
-    return type_suffix(rest, tok, ty);
+    return type_suffix(rest, tok, ty, NULL);
 }
 
 // type-nameをパースする
@@ -520,20 +667,21 @@ static Node *declaration(Token **rest, Token *tok, Type *basety) {
     Node *cur = &head;
     int i = 0;
 
-    while(!equal(tok, ";")) {
+    while(tok->id != ';') {
         if (i++ > 0)
             tok = skip(tok, ",");
 
-        Type *ty = declarator(&tok, tok, basety);
+        Decl decl = {};
+        Type *ty = declarator(&tok, tok, basety, &decl);
         if (ty->kind == TY_VOID)
             error_tok(tok, "void 型の変数を宣言しています");
 
-        Obj *var = new_lvar(get_ident(ty->name), ty);
+        Obj *var = new_lvar(get_ident(decl.name), ty);
 
-        if (!equal(tok, "="))
+        if (tok->id != '=')
             continue;
 
-        Node *lhs = new_var_node(var, ty->name);
+        Node *lhs = new_var_node(var, decl.name);
         Node *rhs = assign(&tok, tok->next);
         Node *node = new_binary(ND_ASSIGN, lhs, rhs, tok);
         cur = cur->next = new_unary(ND_EXPR_STMT, node, tok);
@@ -548,7 +696,7 @@ static Node *declaration(Token **rest, Token *tok, Type *basety) {
 // expr-stmtをパースする
 // expr-stmt = expr? ";"
 static Node *expr_stmt(Token **rest, Token *tok) {
-    if (equal(tok, ";")) {
+    if (tok->id == ';') {
         *rest = tok->next;
         return new_node(ND_BLOCK, tok);
     }
@@ -559,86 +707,6 @@ static Node *expr_stmt(Token **rest, Token *tok) {
     return node;
 }
 
-// exprをパースする
-// expr = assign ("," expr)?
-static Node *expr(Token **rest, Token *tok) {
-    Node *node = assign(&tok, tok);
-
-    if (equal(tok, ","))
-        return new_binary(ND_COMMA, node, expr(rest, tok->next), tok);
-
-    *rest = tok;
-    return node;
-}
-
-// assignをパースする
-// assign = equality ("=" assign)?
-static Node *assign(Token **rest, Token *tok) {
-    Node *node = equality(&tok, tok);
-
-    if (equal(tok, "="))
-        return new_binary(ND_ASSIGN, node, assign(rest, tok->next), tok);
-
-    *rest = tok;
-    return node;
-}
-
-// equalityをパースする
-// equality = relational ("==" relational | "!=" relational)*
-static Node *equality(Token **rest, Token *tok) {
-    Node *node = relational(&tok, tok);
-
-    for (;;) {
-        Token *start = tok;
-
-        if (equal(tok, "==")) {
-            node = new_binary(ND_EQ, node, relational(&tok, tok->next), start);
-            continue;
-        }
-
-        if (equal(tok, "!=")) {
-            node = new_binary(ND_NE, node, relational(&tok, tok->next), start);
-            continue;
-        }
-
-        *rest = tok;
-        return node;
-    }
-}
-
-// relationalをパースする
-// relational = add ("<" add | "<=" add | ">" add | ">=" add)*
-static Node *relational(Token **rest, Token *tok) {
-    Node *node = add(&tok, tok);
-
-    for (;;) {
-        Token *start = tok;
-
-        if (equal(tok, "<")) {
-            node = new_binary(ND_LT, node, add(&tok, tok->next), start);
-            continue;
-        }
-
-        if (equal(tok, "<=")) {
-            node = new_binary(ND_LE, node, add(&tok, tok->next), start);
-            continue;
-        }
-
-        if (equal(tok, ">")) {
-            node = new_binary(ND_LT, add(&tok, tok->next), node, start);
-            continue;
-        }
-
-        if (equal(tok, ">=")) {
-            node = new_binary(ND_LE, add(&tok, tok->next), node, start);
-            continue;
-        }
-
-        *rest = tok;
-        return node;
-    }
-}
-
 // C言語では、+演算子はポインタ演算を実現するためにオーバーロードされている。
 // pがポインタであるとき、p+nはpにnを足すという意味にはならない。
 // pにsizeof(*p)*nを足す、という意味になる。
@@ -647,9 +715,6 @@ static Node *relational(Token **rest, Token *tok) {
 // このため、ポインタ値へ整数値を足すときは、前もって整数値をスケールしておく
 // 必要がある。この関数はこのスケーリングを担当する。
 static Node *new_add(Node *lhs, Node *rhs, Token *tok) {
-    add_type(lhs);
-    add_type(rhs);
-
     // 数値 + 数値
     if (is_integer(lhs->ty) && is_integer(rhs->ty))
         return new_binary(ND_ADD, lhs, rhs, tok);
@@ -672,9 +737,6 @@ static Node *new_add(Node *lhs, Node *rhs, Token *tok) {
 
 // +演算子のように、-演算子もポインタ型のためにオーバーロードする
 static Node *new_sub(Node *lhs, Node *rhs, Token *tok) {
-    add_type(lhs);
-    add_type(rhs);
-
     // num - num
     if (is_integer(lhs->ty) && is_integer(rhs->ty))
         return new_binary(ND_SUB, lhs, rhs, tok);
@@ -682,10 +744,7 @@ static Node *new_sub(Node *lhs, Node *rhs, Token *tok) {
     // ptr - num
     if (lhs->ty->base && is_integer(rhs->ty)) {
         rhs = new_binary(ND_MUL, rhs, new_num(lhs->ty->base->size, tok), tok);
-        add_type(rhs);
-        Node *node = new_binary(ND_SUB, lhs, rhs, tok);
-        node->ty = lhs->ty;
-        return node;
+        return new_binary(ND_SUB, lhs, rhs, tok);
     }
 
     // ptr - ptr（２つの要素間に何個の要素があるかを返す）
@@ -698,65 +757,247 @@ static Node *new_sub(Node *lhs, Node *rhs, Token *tok) {
     error_tok(tok, "正しくないオペランドです");
 }
 
-// addをパースする
-// add = mul ("+" mul | "-" mul)*
-static Node *add(Token **rest, Token *tok) {
-    Node *node = mul(&tok, tok);
+// 二項演算子の優先順位。値が大きいほど強く結合する
+typedef enum {
+    PREC_NONE,
+    PREC_COMMA,      // ,
+    PREC_ASSIGN,     // =
+    PREC_EQUALITY,   // == !=
+    PREC_RELATIONAL, // < <= > >=
+    PREC_ADD,        // + -
+    PREC_MUL,        // * /
+    PREC_UNARY,      // 前置の単項演算子
+} Prec;
+
+// トークンIDから二項演算子としての優先順位を引く表。
+// 二項演算子でないトークンは PREC_NONE になる。
+static Prec binary_prec[PU_ELLIPSIS + 1] = {
+    [',']      = PREC_COMMA,
+    ['=']      = PREC_ASSIGN,
+    [PU_EQ]    = PREC_EQUALITY,
+    [PU_NE]    = PREC_EQUALITY,
+    ['<']      = PREC_RELATIONAL,
+    [PU_LE]    = PREC_RELATIONAL,
+    ['>']      = PREC_RELATIONAL,
+    [PU_GE]    = PREC_RELATIONAL,
+    ['+']      = PREC_ADD,
+    ['-']      = PREC_ADD,
+    ['*']      = PREC_MUL,
+    ['/']      = PREC_MUL,
+};
 
-    for (;;) {
-        Token *start = tok;
+// 演算子スタックの要素。前置の単項演算子は PREC_UNARY、開き括弧は
+// PREC_NONE として、二項演算子と同じスタックに積む。
+typedef struct {
+    Token *tok;
+    Prec prec;
+} Operator;
+
+// 式のパースに使う被演算子と演算子のスタック。関数呼び出しの引数のように
+// 式の中から別の式をパースするときは、いまの内容の上に積んで、戻るときに
+// 元の高さに戻す。
+static Node **operands;
+static int operands_len;
+static int operands_cap;
+
+static Operator *operators;
+static int operators_len;
+static int operators_cap;
+
+// エラーから回復する位置でのパーサの状態を保存する
+static ParserState save_state(void) {
+    return (ParserState){scope, operands_len, operators_len};
+}
 
-        if (equal(tok, "+")) {
-            node = new_add(node, mul(&tok, tok->next), start);
-            continue;
-        }
+// エラーが起きたときに、保存しておいた状態に戻す。途中で入ったブロック
+// スコープからは抜け、式のスタックは元の高さに戻す
+static void restore_state(ParserState state) {
+    while (scope != state.scope)
+        leave_scope();
+    operands_len = state.operands_len;
+    operators_len = state.operators_len;
+}
 
-        if (equal(tok, "-")) {
-            node = new_sub(node, mul(&tok, tok->next), start);
-            continue;
-        }
+static void push_operand(Node *node) {
+    if (operands_len == operands_cap) {
+        operands_cap = operands_cap ? operands_cap * 2 : 64;
+        operands = realloc(operands, sizeof(Node *) * operands_cap);
+    }
+    operands[operands_len++] = node;
+}
 
-        *rest = tok;
+static void push_operator(Token *tok, Prec prec) {
+    if (operators_len == operators_cap) {
+        operators_cap = operators_cap ? operators_cap * 2 : 64;
+        operators = realloc(operators, sizeof(Operator) * operators_cap);
+    }
+    operators[operators_len++] = (Operator){tok, prec};
+}
+
+// 代入演算子とコンマ演算子は右結合で、それ以外の二項演算子は左結合
+static bool is_right_assoc(Prec prec) {
+    return prec == PREC_ASSIGN || prec == PREC_COMMA;
+}
+
+// 二項演算子のノードを作る
+static Node *new_binary_op(Token *tok, Node *lhs, Node *rhs) {
+    switch (tok->id) {
+    case ',':
+        return new_binary(ND_COMMA, lhs, rhs, tok);
+    case '=':
+        return new_binary(ND_ASSIGN, lhs, rhs, tok);
+    case PU_EQ:
+        return new_binary(ND_EQ, lhs, rhs, tok);
+    case PU_NE:
+        return new_binary(ND_NE, lhs, rhs, tok);
+    case '<':
+        return new_binary(ND_LT, lhs, rhs, tok);
+    case PU_LE:
+        return new_binary(ND_LE, lhs, rhs, tok);
+    case '>':
+        // a > b は b < a として扱う
+        return new_binary(ND_LT, rhs, lhs, tok);
+    case PU_GE:
+        return new_binary(ND_LE, rhs, lhs, tok);
+    case '+':
+        return new_add(lhs, rhs, tok);
+    case '-':
+        return new_sub(lhs, rhs, tok);
+    case '*':
+        return new_binary(ND_MUL, lhs, rhs, tok);
+    case '/':
+        return new_binary(ND_DIV, lhs, rhs, tok);
+    default:
+        unreachable();
+    }
+}
+
+// 前置の単項演算子のノードを作る
+static Node *new_unary_op(Token *tok, Node *node) {
+    switch (tok->id) {
+    case '+':
         return node;
+    case '-':
+        return new_unary(ND_NEG, node, tok);
+    case '&':
+        return new_unary(ND_ADDR, node, tok);
+    case '*':
+        return new_unary(ND_DEREF, node, tok);
+    default:
+        unreachable();
+    }
+}
+
+// 演算子スタックの一番上の演算子を、被演算子スタックの上に適用する
+static void reduce(void) {
+    Operator *op = &operators[--operators_len];
+    Node **top = &operands[operands_len - 1];
+
+    if (op->prec == PREC_UNARY) {
+        *top = new_unary_op(op->tok, *top);
+        return;
     }
+
+    operands_len--;
+    top[-1] = new_binary_op(op->tok, top[-1], *top);
 }
 
-// mulをパースする
-// mul = unary ("*" unary | "/" unary)*
-static Node *mul(Token **rest, Token *tok) {
-    Node *node = unary(&tok, tok);
+// binaryをパースする
+// binary = unary (binop unary)*
+// unary  = ("+" | "-" | "*" | "&" | "(")* postfix (")" postfix-suffix)*
+// binop  = "," | "=" | "==" | "!=" | "<" | "<=" | ">" | ">=" | "+" | "-" | "*" | "/"
+//
+// 優先順位ごとに関数を下っていく代わりに、被演算子と演算子を明示的な
+// スタックに積み、binary_prec の表を見ながら還元していく（演算子順位法）。
+// 被演算子ひとつあたりの関数呼び出しは postfix の１回だけで、括弧や単項
+// 演算子がどれだけ深くネストしていても C のスタックは消費しない。
+// 括弧の外で min_prec より弱い二項演算子が現れたら、そこでパースを終える。
+static Node *binary(Token **rest, Token *tok, Prec min_prec) {
+    int operands_base = operands_len;
+    int operators_base = operators_len;
+    int parens = 0;
 
     for (;;) {
-        Token *start = tok;
+        // 前置の単項演算子と開き括弧を積む
+        for (;; tok = tok->next) {
+            if (tok->id == '+' || tok->id == '-' || tok->id == '*' || tok->id == '&') {
+                push_operator(tok, PREC_UNARY);
+                continue;
+            }
 
-        if (equal(tok, "*")) {
-            node = new_binary(ND_MUL, node, unary(&tok, tok->next), start);
-            continue;
+            // "(" "{" は GNU 拡張の式文なので primary に任せる
+            if (tok->id == '(' && tok->next->id != '{') {
+                push_operator(tok, PREC_NONE);
+                parens++;
+                continue;
+            }
+            break;
         }
 
-        if (equal(tok, "/")) {
-            node = new_binary(ND_DIV, node, unary(&tok, tok->next), start);
-            continue;
+        push_operand(postfix(&tok, tok));
+
+        // 閉じ括弧が来たら対応する開き括弧まで還元し、括弧でくくられた式に
+        // 後置演算子を適用する
+        while (parens && tok->id == ')') {
+            while (operators[operators_len - 1].prec != PREC_NONE)
+                reduce();
+            operators_len--;
+            parens--;
+
+            Node **top = &operands[operands_len - 1];
+            *top = postfix_suffix(&tok, tok->next, *top);
         }
 
-        *rest = tok;
-        return node;
+        Prec prec = tok->id <= PU_ELLIPSIS ? binary_prec[tok->id] : PREC_NONE;
+        if (prec == PREC_NONE || (!parens && prec < min_prec))
+            break;
+
+        // 新しい演算子より強く結合する演算子を先に還元する
+        while (operators_len > operators_base) {
+            Prec top = operators[operators_len - 1].prec;
+            if (top == PREC_NONE || top < prec || (top == prec && is_right_assoc(prec)))
+                break;
+            reduce();
+        }
+
+        push_operator(tok, prec);
+        tok = tok->next;
     }
+
+    if (parens)
+        skip(tok, ")");
+
+    while (operators_len > operators_base)
+        reduce();
+
+    assert(operands_len == operands_base + 1);
+    *rest = tok;
+    return operands[--operands_len];
+}
+
+// exprをパースする
+// expr = binary
+static Node *expr(Token **rest, Token *tok) {
+    return binary(rest, tok, PREC_COMMA);
+}
+
+// assignをパースする
+// assign = binary
+//
+// コンマ演算子は括弧の中でしか使えない
+static Node *assign(Token **rest, Token *tok) {
+    return binary(rest, tok, PREC_ASSIGN);
 }
 
-// unaryをパースする
-// unary = ("+" | "-" | "*" | "&")? unary
-//       | postfix
-static Node *unary(Token **rest, Token *tok) {
-    if (equal(tok, "+"))
-        return unary(rest, tok->next);
-    if (equal(tok, "-"))
-        return new_unary(ND_NEG, unary(rest, tok->next), tok);
-    if (equal(tok, "&"))
-        return new_unary(ND_ADDR, unary(rest, tok->next), tok);
-    if (equal(tok, "*"))
-        return new_unary(ND_DEREF, unary(rest, tok->next), tok);
-    return postfix(rest, tok);
+// メンバ名からメンバを引けるよう、構造体の型にメンバを登録する。メンバ名は
+// インターンされているので、名前の文字列ではなく、そのポインタをキーにする。
+// キーはメンバ自身の name フィールドを指すので、別に確保する必要はない。
+// 構造体の型は perm_arena にあるので、表のバケットもそこから確保する
+static void index_member(Type *ty, Member *mem) {
+    char *key = (char *)&mem->name;
+    ty->member_index.arena = &perm_arena;
+    if (!hashmap_get2(&ty->member_index, key, sizeof(mem->name)))
+        hashmap_put2(&ty->member_index, key, sizeof(mem->name), mem);
 }
 
 // struct-membersをパースする
@@ -765,19 +1006,22 @@ static void struct_members(Token **rest, Token *tok, Type *ty) {
     Member head = {};
     Member *cur = &head;
 
-    while(!equal(tok, "}")) {
+    while(tok->id != '}') {
         Type *basety = declspec(&tok, tok, NULL);
         int i = 0;
 
-        while (!consume(&tok, tok, ";")) {
-            if (i++)
+        for (; tok->id != ';'; i++) {
+            if (i)
                 tok = skip(tok, ",");
 
-            Member *mem = calloc(1, sizeof(Member));
-            mem->ty = declarator(&tok, tok, basety);
-            mem->name = mem->ty->name;
+            Member *mem = arena_alloc(&perm_arena, sizeof(Member));
+            Decl decl = {};
+            mem->ty = declarator(&tok, tok, basety, &decl);
+            mem->name = get_ident(decl.name);
+            index_member(ty, mem);
             cur = cur->next = mem;
         }
+        tok = tok->next;
     }
 
     *rest = tok->next;
@@ -794,7 +1038,7 @@ static Type *struct_union_decl(Token **rest, Token *tok) {
         tok = tok->next;
     }
 
-    if (tag && !equal(tok, "{")) {
+    if (tag && tok->id != '{') {
         Type *ty = find_tag(tag);
         if (!ty)
             error_tok(tag, "不明な構造体型です");
@@ -803,7 +1047,7 @@ static Type *struct_union_decl(Token **rest, Token *tok) {
     }
 
     // 構造体オブジェクトをコンストラクトする
-    Type *ty = calloc(1, sizeof(Type));
+    Type *ty = arena_alloc(&perm_arena, sizeof(Type));
     ty->kind = TY_STRUCT;
     struct_members(rest, tok->next, ty);
     ty->align = 1;
@@ -855,31 +1099,36 @@ static Type *union_decl(Token **rest, Token *tok) {
 
 // 指定の構造体の型に指定のメンバがあればそれを返す。なければエラー
 static Member *get_struct_member(Type *ty, Token *tok) {
-    for (Member *mem = ty->members; mem; mem = mem->next)
-        if (mem->name->len == tok->len &&
-            !strncmp(mem->name->loc, tok->loc, tok->len))
-            return mem;
-    error_tok(tok, "指定のメンバがありません");
+    Member *mem = hashmap_get2(&ty->member_index, (char *)&tok->str, sizeof(tok->str));
+    if (!mem)
+        error_tok(tok, "指定のメンバがありません");
+    return mem;
 }
 
 // 構造体メンバへのアクセスに必要な情報を集める
 static Node *struct_ref(Node *lhs, Token *tok) {
-    add_type(lhs);
     if (lhs->ty->kind != TY_STRUCT && lhs->ty->kind != TY_UNION)
         error_tok(lhs->tok, "構造体でも共用体でもありません");
 
-    Node *node = new_unary(ND_MEMBER, lhs, tok);
+    Node *node = new_node(ND_MEMBER, tok);
+    node->lhs = lhs;
     node->member = get_struct_member(lhs->ty, tok);
+    add_type(node);
     return node;
 }
 
 // postfixをパースする
-// postfix = primary ("[" expr "]" | "." ident | "->" ident)*
+// postfix = primary postfix-suffix
 static Node *postfix(Token **rest, Token *tok) {
     Node *node = primary(&tok, tok);
+    return postfix_suffix(rest, tok, node);
+}
 
+// postfix-suffixをパースする
+// postfix-suffix = ("[" expr "]" | "." ident | "->" ident)*
+static Node *postfix_suffix(Token **rest, Token *tok, Node *node) {
     for (;;) {
-        if (equal(tok, "[")) {
+        if (tok->id == '[') {
             // x[y] は *(x+y) と同じ意味
             Token *start = tok;
             Node *idx = expr(&tok, tok->next);
@@ -888,13 +1137,13 @@ static Node *postfix(Token **rest, Token *tok) {
             continue;
         }
 
-        if (equal(tok, ".")) {
+        if (tok->id == '.') {
             node = struct_ref(node, tok->next);
             tok = tok->next->next;
             continue;
         }
 
-        if (equal(tok, "->")) {
+        if (tok->id == PU_ARROW) {
             // x->y は (*x).y を縮めたもの
             node = new_unary(ND_DEREF, node, tok);
             node = struct_ref(node, tok->next);
@@ -916,7 +1165,7 @@ static Node *funcall(Token **rest, Token *tok) {
     Node head = {};
     Node *cur = &head;
 
-    while (!equal(tok, ")")) {
+    while (tok->id != ')') {
         if (cur != &head)
             tok = skip(tok, ",");
         cur = cur->next = assign(&tok, tok);
@@ -925,8 +1174,9 @@ static Node *funcall(Token **rest, Token *tok) {
     *rest = skip(tok, ")");
 
     Node *node = new_node(ND_FUNCALL, start);
-    node->funcname = strndup(start->loc, start->len);
+    node->funcname = start->str;
     node->args = head.next;
+    add_type(node);
     return node;
 }
 
@@ -942,37 +1192,30 @@ static Node *primary(Token **rest, Token *tok) {
     Token *start = tok;
 
     // まずGNU拡張である式文が来る場合はそれをパースする
-    if (equal(tok, "(") && equal(tok->next, "{")) {
+    if (tok->id == '(' && tok->next->id == '{') {
         Node *node = new_node(ND_STMT_EXPR, tok);
         node->body = compound_stmt(&tok, tok->next->next)->body;
+        add_type(node);
         *rest = skip(tok, ")");
         return node;
     }
 
-    // 次のトークンが"("なら、"(" expr ")"のはず
-    if (equal(tok, "(")) {
-        Node *node = expr(&tok, tok->next);
-        *rest = skip(tok, ")");
-        return node;
-    }
-
-    if (equal(tok, "sizeof") && equal(tok->next, "(") && is_typename(tok->next->next)) {
+    if (tok->id == KW_SIZEOF && tok->next->id == '(' && is_typename(tok->next->next)) {
         Type *ty = typename(&tok, tok->next->next);
         *rest = skip(tok, ")");
         return new_num(ty->size, start);
     }
 
     // sizeof演算子による演算結果はコンパイル時に決定される
-    if (equal(tok, "sizeof")) {
-        Node *node = unary(rest, tok->next);
-        add_type(node);
+    if (tok->id == KW_SIZEOF) {
+        Node *node = binary(rest, tok->next, PREC_UNARY);
         return new_num(node->ty->size, tok);
     }
 
     // 次に考えられるのは識別子
     if (tok->kind == TK_IDENT) {
         // 後ろに"("があるなら関数呼び出し
-        if (equal(tok->next, "("))
+        if (tok->next->id == '(')
             return funcall(rest, tok);
 
         // 識別子のみの場合は変数
@@ -985,7 +1228,7 @@ static Node *primary(Token **rest, Token *tok) {
 
     // 文字列リテラル
     if (tok->kind == TK_STR) {
-        Obj *var = new_string_literal(tok->str, tok->ty);
+        Obj *var = new_string_literal(tok->str, array_of(ty_char, tok->val));
         *rest = tok->next;
         return new_var_node(var, tok);
     }
@@ -1005,79 +1248,397 @@ static Node *primary(Token **rest, Token *tok) {
 static Token *parse_typedef(Token *tok, Type *basety) {
     bool first = true;
 
-    while (!consume(&tok, tok, ";")) {
+    while (tok->id != ';') {
         if (!first)
             tok = skip(tok, ",");
         first = false;
 
-        Type *ty = declarator(&tok, tok, basety);
-        push_scope(get_ident(ty->name))->type_def = ty;
+        Decl decl = {};
+        Type *ty = declarator(&tok, tok, basety, &decl);
+        push_scope(get_ident(decl.name))->type_def = ty;
     }
-    return tok;
+    return tok->next;
 }
 
-static void create_param_lvars(Type *param) {
-    if (param) {
-        create_param_lvars(param->next);
-        new_lvar(get_ident(param->name), param);
+// "{" の次から対応する "}" までを読み飛ばし、その次のトークンを返す。
+// 本体はパースしない。
+static Token *skip_body(Token *tok) {
+    for (int depth = 1;; tok = tok->next) {
+        if (tok->kind == TK_EOF)
+            error_tok(tok, "記号 '}' が必要です");
+        if (tok->id == '{')
+            depth++;
+        else if (tok->id == '}' && --depth == 0)
+            return tok->next;
     }
 }
 
-// function-definitionをパースする
-// function-definition = declspec declarator compound_stmt
-static Token *function(Token *tok, Type *basety) {
-    Type *ty = declarator(&tok, tok, basety);
+//
+// 定数の畳み込み
+//
+// 関数の本体をパースし終えたら構文木をたどり、値が定数になる式を ND_NUM に
+// 置き換え、x*1 や x+0 のような式を簡単にする。条件が定数の "if" と "for"
+// は、実行されない側の文を取り除く。
+//
+// コード生成は型にかかわらず RAX の 64 ビットで計算するので、畳み込みも
+// 64 ビットの 2 の補数で計算する。型はノードを組み立てたときに決まって
+// いるので、式を子の式で置き換えても親の型は変わらない。
+//
 
-    Obj *fn = new_gvar(get_ident(ty->name), ty);
-    fn->is_function = true;
-    fn->is_definition = !consume(&tok, tok, ";");
+static Node *fold(Node *node);
+static Node *fold_stmt(Node *node);
 
-    if (!fn->is_definition)
-        return tok;
+static bool is_num(Node *node, int64_t val) {
+    return node->kind == ND_NUM && node->val == val;
+}
+
+// ノードをその場で整数のノードに書き換える
+static Node *to_num(Node *node, int64_t val) {
+    node->kind = ND_NUM;
+    node->val = val;
+    return node;
+}
+
+// 文のノードをその場で空のブロックに書き換える
+static Node *to_empty(Node *node) {
+    node->kind = ND_BLOCK;
+    node->body = NULL;
+    return node;
+}
+
+// 式が副作用を持たなければ真。そのような式は取り除いてもよい。
+// 割り算は、0 除算やオーバーフローで例外を起こさないとわかる場合に限る
+static bool is_pure(Node *node) {
+    switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+        return true;
+    case ND_NEG:
+    case ND_MEMBER:
+    case ND_ADDR:
+    case ND_DEREF:
+        return is_pure(node->lhs);
+    case ND_DIV:
+        if (node->rhs->kind != ND_NUM || node->rhs->val == 0 || node->rhs->val == -1)
+            return false;
+        return is_pure(node->lhs);
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+    case ND_COMMA:
+        return is_pure(node->lhs) && is_pure(node->rhs);
+    default:
+        return false;
+    }
+}
+
+// ふたつの副作用のない式が、同じ値を計算する同じ形の式であれば真
+static bool same_expr(Node *a, Node *b) {
+    if (a->kind != b->kind)
+        return false;
+
+    switch (a->kind) {
+    case ND_NUM:
+        return a->val == b->val;
+    case ND_VAR:
+        return a->var == b->var;
+    case ND_MEMBER:
+        return a->member == b->member && same_expr(a->lhs, b->lhs);
+    case ND_NEG:
+    case ND_ADDR:
+    case ND_DEREF:
+        return same_expr(a->lhs, b->lhs);
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_DIV:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+    case ND_COMMA:
+        return same_expr(a->lhs, b->lhs) && same_expr(a->rhs, b->rhs);
+    default:
+        return false;
+    }
+}
+
+// 両辺が定数の二項演算を計算して `val` に返す。実行時にエラーになる
+// 割り算は計算せず、偽を返す
+static bool eval_binary(NodeKind kind, int64_t lhs, int64_t rhs, int64_t *val) {
+    switch (kind) {
+    case ND_ADD:
+        *val = (uint64_t)lhs + rhs;
+        return true;
+    case ND_SUB:
+        *val = (uint64_t)lhs - rhs;
+        return true;
+    case ND_MUL:
+        *val = (uint64_t)lhs * rhs;
+        return true;
+    case ND_DIV:
+        if (rhs == 0 || (lhs == INT64_MIN && rhs == -1))
+            return false;
+        *val = lhs / rhs;
+        return true;
+    case ND_EQ:
+        *val = lhs == rhs;
+        return true;
+    case ND_NE:
+        *val = lhs != rhs;
+        return true;
+    case ND_LT:
+        *val = lhs < rhs;
+        return true;
+    case ND_LE:
+        *val = lhs <= rhs;
+        return true;
+    default:
+        return false;
+    }
+}
+
+// 子を畳み込み済みの二項演算を畳み込む
+static Node *fold_binary(Node *node) {
+    Node *lhs = node->lhs;
+    Node *rhs = node->rhs;
+
+    int64_t val;
+    if (lhs->kind == ND_NUM && rhs->kind == ND_NUM &&
+        eval_binary(node->kind, lhs->val, rhs->val, &val))
+        return to_num(node, val);
+
+    switch (node->kind) {
+    case ND_ADD:
+        if (is_num(rhs, 0))
+            return lhs;
+        if (is_num(lhs, 0))
+            return rhs;
+        break;
+    case ND_SUB:
+        if (is_num(rhs, 0))
+            return lhs;
+        if (is_pure(lhs) && same_expr(lhs, rhs))
+            return to_num(node, 0);
+        break;
+    case ND_MUL:
+        if (is_num(rhs, 1))
+            return lhs;
+        if (is_num(lhs, 1))
+            return rhs;
+        if ((is_num(rhs, 0) && is_pure(lhs)) || (is_num(lhs, 0) && is_pure(rhs)))
+            return to_num(node, 0);
+        break;
+    case ND_DIV:
+        if (is_num(rhs, 1))
+            return lhs;
+        break;
+    }
+    return node;
+}
+
+// アドレスを求める式を畳み込む。左辺値でなくなるような置き換えはしない
+static Node *fold_lvalue(Node *node) {
+    switch (node->kind) {
+    case ND_DEREF:
+        node->lhs = fold(node->lhs);
+        break;
+    case ND_MEMBER:
+        node->lhs = fold_lvalue(node->lhs);
+        break;
+    case ND_COMMA:
+        node->lhs = fold(node->lhs);
+        node->rhs = fold_lvalue(node->rhs);
+        break;
+    }
+    return node;
+}
+
+// 文のリストを畳み込む。空になった文はリストから取り除く
+static Node *fold_stmts(Node *node) {
+    Node head = {};
+    Node *cur = &head;
 
+    while (node) {
+        Node *next = node->next;
+        Node *stmt = fold_stmt(node);
+        if (stmt->kind != ND_BLOCK || stmt->body)
+            cur = cur->next = stmt;
+        node = next;
+    }
+    cur->next = NULL;
+    return head.next;
+}
+
+// 式を畳み込み、置き換えた式を返す
+static Node *fold(Node *node) {
+    if (!node)
+        return NULL;
+
+    switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+        return node;
+    case ND_MEMBER:
+    case ND_ADDR:
+        node->lhs = fold_lvalue(node->lhs);
+        return node;
+    case ND_DEREF:
+        node->lhs = fold(node->lhs);
+        return node;
+    case ND_NEG:
+        node->lhs = fold(node->lhs);
+        if (node->lhs->kind == ND_NUM)
+            return to_num(node, -(uint64_t)node->lhs->val);
+        return node;
+    case ND_ASSIGN:
+        node->lhs = fold_lvalue(node->lhs);
+        node->rhs = fold(node->rhs);
+        return node;
+    case ND_FUNCALL:
+        for (Node **arg = &node->args; *arg; arg = &(*arg)->next) {
+            Node *next = (*arg)->next;
+            *arg = fold(*arg);
+            (*arg)->next = next;
+        }
+        return node;
+    case ND_STMT_EXPR:
+        node->body = fold_stmts(node->body);
+        return node;
+    case ND_COMMA:
+        node->lhs = fold(node->lhs);
+        node->rhs = fold(node->rhs);
+        if (is_pure(node->lhs))
+            return node->rhs;
+        return node;
+    default:
+        node->lhs = fold(node->lhs);
+        node->rhs = fold(node->rhs);
+        return fold_binary(node);
+    }
+}
+
+// 文を畳み込み、置き換えた文を返す。何もしない文は空のブロックになる
+static Node *fold_stmt(Node *node) {
+    switch (node->kind) {
+    case ND_IF:
+        node->cond = fold(node->cond);
+        node->then = fold_stmt(node->then);
+        if (node->els)
+            node->els = fold_stmt(node->els);
+        if (node->cond->kind != ND_NUM)
+            return node;
+        if (node->cond->val)
+            return node->then;
+        return node->els ? node->els : to_empty(node);
+    case ND_FOR:
+        if (node->init)
+            node->init = fold_stmt(node->init);
+        node->cond = fold(node->cond);
+        node->then = fold_stmt(node->then);
+        node->inc = fold(node->inc);
+        if (node->cond && node->cond->kind == ND_NUM) {
+            // 条件が偽であれば初期化だけが実行される。真であれば無限ループ
+            if (!node->cond->val)
+                return node->init ? node->init : to_empty(node);
+            node->cond = NULL;
+        }
+        return node;
+    case ND_BLOCK:
+        node->body = fold_stmts(node->body);
+        return node;
+    case ND_RETURN:
+    case ND_EXPR_STMT:
+        node->lhs = fold(node->lhs);
+        return node;
+    default:
+        return node;
+    }
+}
+
+// 仮引数のローカル変数を作る。locals の先頭が最初の仮引数になるよう、
+// 後ろから作る
+static void create_param_lvars(Type *ty, char **names) {
+    for (int i = ty->param_cnt - 1; i >= 0; i--)
+        new_lvar(names[i], ty->params[i]);
+}
+
+// 関数の本体をパースして `fn` に設定する。`names` は仮引数の名前
+static Token *function_body(Token *tok, Obj *fn, char **names) {
     locals = NULL;
+    fn_arena = body_arena;
     enter_scope();
-    create_param_lvars(ty->params);
+    create_param_lvars(fn->ty, names);
     fn->params = locals;
 
     tok = skip(tok, "{");
-    fn->body = compound_stmt(&tok, tok);
+    fn->body = fold_stmt(compound_stmt(&tok, tok));
     fn->locals = locals;
     leave_scope();
+    fn_arena = file_arena;
     return tok;
 }
 
-// global-variableをパースする
-// global-variable = declspec declarator ("," declarator) ";"
-static Token *global_variable(Token *tok, Type *basety) {
-    bool first = true;
-
-    while (!consume(&tok, tok, ";")) {
-        if (!first)
-            tok = skip(tok, ",");
-        first = false;
+// function-definitionをパースする
+// function-definition = declspec declarator compound_stmt
+//
+// 宣言子は呼び出し元でパース済みで、`ty` はその関数型である。
+// 関数定義であれば、その関数を `def` に返す
+static Token *function(Token *tok, Type *ty, Decl *decl, Obj **def) {
+    Obj *fn = new_gvar(get_ident(decl->name), ty);
+    fn->is_function = true;
+    fn->is_definition = tok->id != ';';
 
-        Type *ty = declarator(&tok, tok, basety);
-        new_gvar(get_ident(ty->name), ty);
+    if (!fn->is_definition)
+        return tok->next;
+    *def = fn;
+
+    // 宣言だけが必要なときは、本体は括弧の対応だけを見て読み飛ばす。
+    // 入力ファイルにある本体は、あとで読み直せるように位置を覚えておく
+    if (skip_bodies) {
+        Token *end = skip_body(skip(tok, "{"));
+        if (tok->file == get_input_files()[0]) {
+            LazyBody *lazy = arena_alloc(file_arena, sizeof(LazyBody));
+            lazy->loc = tok->loc;
+            lazy->hash = hash_tokens(tok, end);
+            lazy->param_names = arena_alloc(file_arena, sizeof(char *) * ty->param_cnt);
+            for (int i = 0; i < ty->param_cnt; i++)
+                lazy->param_names[i] = get_ident(decl->params[i]);
+            fn->lazy = lazy;
+        }
+        return end;
     }
-    return tok;
-}
 
-// トークンを先読みして、与えられたトークンが関数定義か関数宣言を
-// 開始するトークンだった場合、trueを返す
-static bool is_function(Token *tok) {
-    if (equal(tok, ";"))
-        return false;
+    char **names = arena_alloc(body_arena, sizeof(char *) * ty->param_cnt);
+    for (int i = 0; i < ty->param_cnt; i++)
+        names[i] = get_ident(decl->params[i]);
+    return function_body(tok, fn, names);
+}
 
-    Type dummy = {};
-    Type *ty = declarator(&tok, tok, &dummy);
-    return ty->kind == TY_FUNC;
+// global-variableをパースする
+// global-variable = declspec declarator ("," declarator) ";"
+//
+// 最初の宣言子は呼び出し元でパース済みで、`ty` と `decl` はその型と名前である
+static Token *global_variable(Token *tok, Type *basety, Type *ty, Decl *decl) {
+    for (;;) {
+        new_gvar(get_ident(decl->name), ty);
+        if (tok->id == ';')
+            return tok->next;
+        tok = skip(tok, ",");
+        *decl = (Decl){};
+        ty = declarator(&tok, tok, basety, decl);
+    }
 }
 
-// programをパースする
-// program = (typedef | function-definition | global-variable)*
-Obj *parse(Token *tok) {
-    globals = NULL;
+// トップレベルの宣言をパースする。関数定義があった場合はその関数を返す。
+// 関数定義のノードはトークンを参照しているので、関数のコードを生成し終える
+// まではトークンを解放してはならない
+static Obj *toplevel(Token *tok) {
+    Obj *def = NULL;
 
     while (tok->kind != TK_EOF) {
         VarAttr attr = {};
@@ -1089,14 +1650,1088 @@ Obj *parse(Token *tok) {
             continue;
         }
 
+        // 宣言子のない宣言（構造体の宣言など）
+        if (tok->id == ';') {
+            tok = tok->next;
+            continue;
+        }
+
+        // 最初の宣言子を読めば、関数かグローバル変数かが分かる
+        Decl decl = {};
+        Type *ty = declarator(&tok, tok, basety, &decl);
+
         // 関数
-        if (is_function(tok)) {
-            tok = function(tok, basety);
+        if (ty->kind == TY_FUNC) {
+            tok = function(tok, ty, &decl, &def);
             continue;
         }
 
         // グローバル変数
-        tok = global_variable(tok, basety);
+        tok = global_variable(tok, basety, ty, &decl);
+    }
+    return def;
+}
+
+//
+// 共通のプリフィックスのスナップショット
+//
+// 多くの翻訳単位は、同じヘッダ群から成る共通の宣言の並びで始まる。
+// その部分をパースした後のグローバルスコープ（変数、typedef、構造体タグ）と、
+// そこから参照される型とグローバル変数をファイルに書き出しておけば、次からは
+// それを読み込むだけで、同じ宣言の並びをパースし直さずに済む。
+//
+// スナップショットには、プリフィックスの各トップレベル宣言のトークンの
+// つづりのハッシュ値も記録する。入力の先頭の宣言がすべて一致すれば、
+// パーサの状態をスナップショットで置き換えて、最初に異なる宣言からパースを
+// 続ける。途中で一致しなくなったら、スナップショットは使わず、保留していた
+// 宣言を普通にパースする。
+//
+// 関数の本体はスナップショットに含められないので、プリフィックスには
+// 関数定義があってはならない。
+//
+
+#define PREFIX_MAGIC "chibicc-prefix-2"
+
+// 型の番号。組み込み型は固定の番号を持つ
+enum {
+    TYPE_NULL = -1,
+    TYPE_VOID,
+    TYPE_CHAR,
+    TYPE_SHORT,
+    TYPE_INT,
+    TYPE_LONG,
+    TYPE_FIRST_USER,
+};
+
+// 書き出すスナップショットのパスと、プリフィックスの宣言ごとのハッシュ値
+static char *prefix_out;
+static uint64_t *out_hashes;
+static int out_hashes_cnt;
+
+// 読み込んだスナップショット。data はファイルの内容、buf はハッシュ値の後の
+// パーサの状態を指す。ハッシュ値の並びは 8 バイト境界に揃っていないので、
+// memcpy で読むこと
+static struct {
+    char *data;
+    char *hashes;
+    int hashes_cnt;
+    char *buf;
+    char *end;
+} prefix_in;
+
+// トップレベルの宣言のつづりのハッシュ値。`end` が NULL でなければ、その手前までのハッシュ値
+static uint64_t hash_tokens(Token *tok, Token *end) {
+    uint64_t hash = 0xcbf29ce484222325;
+    for (; tok != end && tok->kind != TK_EOF; tok = tok->next) {
+        for (int i = 0; i < tok->len; i++) {
+            hash *= 0x100000001b3;
+            hash ^= (unsigned char)tok->loc[i];
+        }
+        // トークンの区切りもハッシュに含める
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+static void write_int(FILE *out, int64_t val) {
+    fwrite(&val, sizeof(val), 1, out);
+}
+
+static void write_str(FILE *out, char *s, int len) {
+    write_int(out, s ? len : -1);
+    if (s)
+        fwrite(s, 1, len, out);
+}
+
+// 型に番号を振る。番号を振った型は `types` に順に並べる。
+static int type_id(HashMap *ids, Type ***types, int *cnt, Type *ty) {
+    if (!ty)
+        return TYPE_NULL;
+    if (ty == ty_void)
+        return TYPE_VOID;
+    if (ty == ty_char)
+        return TYPE_CHAR;
+    if (ty == ty_short)
+        return TYPE_SHORT;
+    if (ty == ty_int)
+        return TYPE_INT;
+    if (ty == ty_long)
+        return TYPE_LONG;
+
+    int *id = hashmap_get2(ids, (char *)&ty, sizeof(ty));
+    if (id)
+        return *id;
+
+    char *key = memcpy(arena_alloc(&perm_arena, sizeof(ty)), &ty, sizeof(ty));
+    id = arena_alloc(&perm_arena, sizeof(int));
+    *id = TYPE_FIRST_USER + (*cnt)++;
+    hashmap_put2(ids, key, sizeof(ty), id);
+    *types = realloc(*types, sizeof(Type *) * *cnt);
+    (*types)[*cnt - 1] = ty;
+
+    // 参照している型にも番号を振る
+    type_id(ids, types, cnt, ty->base);
+    type_id(ids, types, cnt, ty->return_ty);
+    for (int i = 0; i < ty->param_cnt; i++)
+        type_id(ids, types, cnt, ty->params[i]);
+    for (Member *mem = ty->members; mem; mem = mem->next)
+        type_id(ids, types, cnt, mem->ty);
+    return *id;
+}
+
+// 現在のパーサの状態をスナップショットとして書き出す
+static void save_prefix(void) {
+    if (scope->next)
+        unreachable();
+
+    FILE *out = fopen(prefix_out, "w");
+    if (!out)
+        error("スナップショットを書き出せませんでした: %s: %s", prefix_out, strerror(errno));
+
+    HashMap ids = {.arena = &perm_arena};
+    Type **types = NULL;
+    int ntypes = 0;
+
+    // グローバル変数と、スコープ中の型に番号を振る
+    int nglobals = 0;
+    for (Obj *var = globals; var; var = var->next) {
+        type_id(&ids, &types, &ntypes, var->ty);
+        nglobals++;
+    }
+    int nvars = 0, ntags = 0;
+    for (VarScope *sc = scope->vars; sc; sc = sc->next) {
+        type_id(&ids, &types, &ntypes, sc->type_def);
+        nvars++;
+    }
+    for (TagScope *sc = scope->tags; sc; sc = sc->next) {
+        type_id(&ids, &types, &ntypes, sc->ty);
+        ntags++;
+    }
+
+    fwrite(PREFIX_MAGIC, 1, sizeof(PREFIX_MAGIC), out);
+    write_int(out, out_hashes_cnt);
+    fwrite(out_hashes, sizeof(uint64_t), out_hashes_cnt, out);
+    write_int(out, unique_id);
+
+    // 型
+    write_int(out, ntypes);
+    for (int i = 0; i < ntypes; i++) {
+        Type *ty = types[i];
+        write_int(out, ty->kind);
+        write_int(out, ty->size);
+        write_int(out, ty->align);
+        write_int(out, ty->array_len);
+        write_int(out, type_id(&ids, &types, &ntypes, ty->base));
+        write_int(out, type_id(&ids, &types, &ntypes, ty->return_ty));
+        write_int(out, ty->param_cnt);
+        for (int j = 0; j < ty->param_cnt; j++)
+            write_int(out, type_id(&ids, &types, &ntypes, ty->params[j]));
+
+        int nmembers = 0;
+        for (Member *mem = ty->members; mem; mem = mem->next)
+            nmembers++;
+        write_int(out, nmembers);
+        for (Member *mem = ty->members; mem; mem = mem->next) {
+            write_int(out, type_id(&ids, &types, &ntypes, mem->ty));
+            write_str(out, mem->name, mem->name ? strlen(mem->name) : 0);
+            write_int(out, mem->offset);
+        }
+    }
+
+    // グローバル変数。スコープからは、globals の中の位置で参照する
+    write_int(out, nglobals);
+    for (Obj *var = globals; var; var = var->next) {
+        write_str(out, var->name, strlen(var->name));
+        write_int(out, type_id(&ids, &types, &ntypes, var->ty));
+        write_int(out, var->is_function);
+        write_int(out, var->is_definition);
+        write_str(out, var->init_data, var->ty->size);
+    }
+
+    write_int(out, nvars);
+    for (VarScope *sc = scope->vars; sc; sc = sc->next) {
+        int idx = -1;
+        if (sc->var) {
+            idx = 0;
+            for (Obj *var = globals; var != sc->var; var = var->next)
+                idx++;
+        }
+        write_str(out, sc->name, strlen(sc->name));
+        write_int(out, idx);
+        write_int(out, type_id(&ids, &types, &ntypes, sc->type_def));
+    }
+
+    write_int(out, ntags);
+    for (TagScope *sc = scope->tags; sc; sc = sc->next) {
+        write_str(out, sc->name, strlen(sc->name));
+        write_int(out, type_id(&ids, &types, &ntypes, sc->ty));
+    }
+
+    fclose(out);
+}
+
+// `cond` が偽であれば、スナップショットが壊れていると報告して終了する
+static void check_prefix(bool cond) {
+    if (!cond)
+        error("スナップショットが壊れています");
+}
+
+static int64_t read_int(char **p) {
+    check_prefix(prefix_in.end - *p >= sizeof(int64_t));
+    int64_t val;
+    memcpy(&val, *p, sizeof(val));
+    *p += sizeof(val);
+    return val;
+}
+
+// 文字列を読む。`atom` が真であればインターンして返す
+static char *read_str(char **p, bool atom) {
+    int64_t len = read_int(p);
+    if (len < 0)
+        return NULL;
+    check_prefix(prefix_in.end - *p >= len);
+    char *s = atom ? intern(*p, len) : memcpy(arena_alloc(&perm_arena, len), *p, len);
+    *p += len;
+    return s;
+}
+
+// 要素の数を読む。どの要素も少なくとも整数１つ分の大きさがあるので、
+// 残りのバイト数より多ければ壊れている
+static int read_count(char **p) {
+    int64_t cnt = read_int(p);
+    check_prefix(0 <= cnt && cnt <= (prefix_in.end - *p) / (int64_t)sizeof(int64_t));
+    return cnt;
+}
+
+// 大きさ `size` のバイト列、または NULL を読む
+static char *read_data(char **p, int64_t size) {
+    char *q = *p;
+    int64_t len = read_int(&q);
+    check_prefix(len < 0 || len == size);
+    return read_str(p, false);
+}
+
+static Type *read_type(char **p, Type **types, int ntypes) {
+    int64_t id = read_int(p);
+    switch (id) {
+    case TYPE_NULL:
+        return NULL;
+    case TYPE_VOID:
+        return ty_void;
+    case TYPE_CHAR:
+        return ty_char;
+    case TYPE_SHORT:
+        return ty_short;
+    case TYPE_INT:
+        return ty_int;
+    case TYPE_LONG:
+        return ty_long;
+    }
+    check_prefix(TYPE_FIRST_USER <= id && id - TYPE_FIRST_USER < ntypes);
+    return types[id - TYPE_FIRST_USER];
+}
+
+// スナップショットから読んだ型 `buf[i]` を正規化したものを `types[i]` に求める。
+// ポインタ、配列、関数の型は、この翻訳単位でこれから作る型と同一になるよう、
+// type.c で正規化し直す。構造体と共用体はそのまま使う。
+static Type *canonical_type(Type *buf, Type **types, int ntypes, Type *ty) {
+    if (ty < buf || buf + ntypes <= ty)
+        return ty; // NULL または組み込み型
+
+    // 型の参照が構造体を経ずに循環していれば壊れている
+    static Type visiting;
+    int i = ty - buf;
+    check_prefix(types[i] != &visiting);
+    if (types[i])
+        return types[i];
+    types[i] = &visiting;
+
+    switch (ty->kind) {
+    case TY_PTR:
+        return types[i] = pointer_to(canonical_type(buf, types, ntypes, ty->base));
+    case TY_ARRAY:
+        return types[i] = array_of(canonical_type(buf, types, ntypes, ty->base), ty->array_len);
+    case TY_FUNC:
+        for (int j = 0; j < ty->param_cnt; j++)
+            ty->params[j] = canonical_type(buf, types, ntypes, ty->params[j]);
+        ty->return_ty = canonical_type(buf, types, ntypes, ty->return_ty);
+        return types[i] = func_type(ty->return_ty, ty->params, ty->param_cnt);
+    default:
+        types[i] = ty;
+        for (Member *mem = ty->members; mem; mem = mem->next)
+            mem->ty = canonical_type(buf, types, ntypes, mem->ty);
+        return ty;
+    }
+}
+
+// スナップショットのパーサの状態を復元する
+static void restore_prefix(void) {
+    char *p = prefix_in.buf;
+    unique_id = read_int(&p);
+
+    // 型はまず読んだとおりに組み立て、それから正規化する
+    int ntypes = read_count(&p);
+    Type *buf = arena_alloc(&perm_arena, sizeof(Type) * ntypes);
+    Type **raw = calloc(ntypes, sizeof(Type *));
+    for (int i = 0; i < ntypes; i++)
+        raw[i] = &buf[i];
+
+    for (int i = 0; i < ntypes; i++) {
+        Type *ty = raw[i];
+        ty->kind = read_int(&p);
+        ty->size = read_int(&p);
+        ty->align = read_int(&p);
+        ty->array_len = read_int(&p);
+        ty->base = read_type(&p, raw, ntypes);
+        ty->return_ty = read_type(&p, raw, ntypes);
+        ty->param_cnt = read_count(&p);
+
+        // コード生成は大きさをアラインメントで切り上げるので、関数以外の
+        // 型のアラインメントは正の 2 の冪でなければならない
+        check_prefix(TY_VOID <= ty->kind && ty->kind <= TY_UNION);
+        if (ty->kind != TY_FUNC)
+            check_prefix(ty->size >= 0 && ty->align > 0 && (ty->align & (ty->align - 1)) == 0);
+        if (ty->kind == TY_PTR || ty->kind == TY_ARRAY)
+            check_prefix(ty->base);
+        if (ty->kind == TY_ARRAY)
+            check_prefix(ty->array_len >= 0);
+        if (ty->kind == TY_FUNC)
+            check_prefix(ty->return_ty);
+
+        ty->params = arena_alloc(&perm_arena, sizeof(Type *) * ty->param_cnt);
+        for (int j = 0; j < ty->param_cnt; j++) {
+            ty->params[j] = read_type(&p, raw, ntypes);
+            check_prefix(ty->params[j]);
+        }
+
+        Member head = {};
+        Member *cur = &head;
+        int nmembers = read_count(&p);
+        for (int j = 0; j < nmembers; j++) {
+            Member *mem = arena_alloc(&perm_arena, sizeof(Member));
+            mem->ty = read_type(&p, raw, ntypes);
+            mem->name = read_str(&p, true);
+            mem->offset = read_int(&p);
+            check_prefix(mem->ty && 0 <= mem->offset && mem->offset <= ty->size);
+            index_member(ty, mem);
+            cur = cur->next = mem;
+        }
+        ty->members = head.next;
+    }
+
+    Type **types = calloc(ntypes, sizeof(Type *));
+    for (int i = 0; i < ntypes; i++)
+        canonical_type(buf, types, ntypes, raw[i]);
+    free(raw);
+
+    int nglobals = read_count(&p);
+    Obj **vars = calloc(nglobals, sizeof(Obj *));
+    for (int i = 0; i < nglobals; i++) {
+        Obj *var = arena_alloc(&perm_arena, sizeof(Obj));
+        var->name = read_str(&p, true);
+        var->ty = read_type(&p, types, ntypes);
+        check_prefix(var->name && var->ty);
+        var->is_function = read_int(&p);
+        var->is_definition = read_int(&p);
+        check_prefix(var->is_function == (var->ty->kind == TY_FUNC));
+        var->init_data = read_data(&p, var->ty->size);
+        if (i > 0)
+            vars[i - 1]->next = var;
+        vars[i] = var;
     }
+    globals = nglobals ? vars[0] : NULL;
+
+    // スコープの宣言は新しいものから並んでいるので、古いものから登録し直す
+    int nvars = read_count(&p);
+    VarScope **vscopes = calloc(nvars, sizeof(VarScope *));
+    for (int i = 0; i < nvars; i++) {
+        VarScope *sc = arena_alloc(&perm_arena, sizeof(VarScope));
+        sc->name = read_str(&p, true);
+        int64_t idx = read_int(&p);
+        check_prefix(sc->name && -1 <= idx && idx < nglobals);
+        sc->var = idx < 0 ? NULL : vars[idx];
+        sc->type_def = read_type(&p, types, ntypes);
+        check_prefix(!sc->var != !sc->type_def);
+        vscopes[i] = sc;
+    }
+    for (int i = nvars - 1; i >= 0; i--)
+        bind_var(vscopes[i]);
+
+    int ntags = read_count(&p);
+    TagScope **tscopes = calloc(ntags, sizeof(TagScope *));
+    for (int i = 0; i < ntags; i++) {
+        TagScope *sc = arena_alloc(&perm_arena, sizeof(TagScope));
+        sc->name = read_str(&p, true);
+        sc->ty = read_type(&p, types, ntypes);
+        check_prefix(sc->name && sc->ty && (sc->ty->kind == TY_STRUCT || sc->ty->kind == TY_UNION));
+        tscopes[i] = sc;
+    }
+    for (int i = ntags - 1; i >= 0; i--)
+        bind_tag(tscopes[i]);
+
+    free(vscopes);
+    free(tscopes);
+
+    free(types);
+    free(vars);
+}
+
+// パースが終わったら、パーサの状態をスナップショットとして書き出す
+void emit_prefix(char *path) {
+    prefix_out = path;
+}
+
+// スナップショットを読み込み、入力がそのプリフィックスで始まっていれば
+// パースを省略できるようにする
+void use_prefix(char *path) {
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        error("スナップショットを開けませんでした: %s: %s", path, strerror(errno));
+
+    char *buf;
+    size_t buflen;
+    FILE *out = open_memstream(&buf, &buflen);
+    char tmp[4096];
+    for (size_t n; (n = fread(tmp, 1, sizeof(tmp), fp));)
+        fwrite(tmp, 1, n, out);
+    fclose(fp);
+    fclose(out);
+
+    prefix_in.data = buf;
+    prefix_in.end = buf + buflen;
+    if (buflen < sizeof(PREFIX_MAGIC) || memcmp(buf, PREFIX_MAGIC, sizeof(PREFIX_MAGIC)))
+        error("スナップショットではありません: %s", path);
+
+    char *p = buf + sizeof(PREFIX_MAGIC);
+    prefix_in.hashes_cnt = read_count(&p);
+    prefix_in.hashes = p;
+    prefix_in.buf = p + prefix_in.hashes_cnt * sizeof(uint64_t);
+}
+
+// 関数定義をパースするたびに呼ぶ、コード生成の関数
+static void (*emit_function)(Obj *fn);
+
+// トップレベルの宣言を１つパースする
+static void parse_toplevel(Token *tok) {
+    if (prefix_out) {
+        out_hashes = realloc(out_hashes, sizeof(uint64_t) * (out_hashes_cnt + 1));
+        out_hashes[out_hashes_cnt++] = hash_tokens(tok, NULL);
+    }
+
+    // 宣言の途中でエラーが起きたら、その宣言の残りは捨てて次の宣言から続ける
+    jmp_buf jmp;
+    ParserState state = save_state();
+    if (setjmp(jmp)) {
+        error_recovery = NULL;
+        restore_state(state);
+        locals = NULL;
+        fn_arena = file_arena;
+        arena_release(&ast_arena);
+        release_tokens(tok);
+        return;
+    }
+    error_recovery = &jmp;
+    Obj *fn = toplevel(tok);
+    error_recovery = NULL;
+
+    if (fn && prefix_out)
+        error_tok(tok, "プリフィックスに関数定義は含められません");
+    if (!fn) {
+        release_tokens(tok);
+        return;
+    }
+
+    // 関数定義はすぐにコード生成に渡し、本体の構文木、ローカル変数、
+    // トークンを解放する。同時に保持する構文木は関数１つ分で済む。
+    // エラーがあった後は、コードを生成しても使われないので生成しない
+    if (emit_function && !error_cnt)
+        emit_function(fn);
+    fn->params = NULL;
+    fn->body = NULL;
+    fn->locals = NULL;
+    arena_release(&ast_arena);
+    release_tokens(tok);
+}
+
+// programをパースする
+// program = (typedef | function-definition | global-variable)*
+//
+// トークンはトップレベルの宣言ごとにトークナイザから受け取り、
+// 不要になったものはすぐに解放する。関数定義はパースするたびに
+// `emit` に渡す。返すグローバル変数のリストに含まれる関数は、
+// 本体を持たない。
+Obj *parse(void (*emit)(Obj *fn)) {
+    globals = NULL;
+    emit_function = emit;
+
+    // スナップショットがあれば、そのプリフィックスの宣言の数だけ先に読み、
+    // すべて一致すればパースせずにスナップショットの状態から始める
+    int n = prefix_in.hashes_cnt;
+    Token **pending = calloc(n + 1, sizeof(Token *));
+    int npending = 0;
+    bool matched = n > 0;
+    for (int i = 0; i < n; i++) {
+        Token *tok = read_toplevel();
+        pending[npending++] = tok;
+        uint64_t hash;
+        memcpy(&hash, prefix_in.hashes + i * sizeof(uint64_t), sizeof(hash));
+        if (tok->kind == TK_EOF || hash_tokens(tok, NULL) != hash) {
+            matched = false;
+            break;
+        }
+    }
+
+    if (matched) {
+        for (int i = 0; i < npending; i++)
+            release_tokens(pending[i]);
+        npending = 0;
+        restore_prefix();
+
+        if (prefix_out) {
+            out_hashes = malloc(sizeof(uint64_t) * n);
+            memcpy(out_hashes, prefix_in.hashes, sizeof(uint64_t) * n);
+            out_hashes_cnt = n;
+        }
+    }
+
+    for (int i = 0;; i++) {
+        Token *tok = i < npending ? pending[i] : read_toplevel();
+        if (tok->kind == TK_EOF)
+            break;
+        parse_toplevel(tok);
+        release_consumed_input();
+    }
+    free(pending);
+
+    // エラーはすべて報告し終えた
+    if (error_cnt)
+        exit(1);
+
+    if (prefix_out)
+        save_prefix();
     return globals;
 }
+
+//
+// 増分パース
+//
+// エディタなどで小さな編集のたびにパースし直すときは、入力全体を読み直す
+// のではなく、編集を含むトップレベルの宣言だけをトークナイズし直す。その
+// ために、トップレベルの宣言ごとにトークンと構文木を保持しておき、宣言ごとの
+// 領域から確保する。
+//
+// 読み直した宣言が関数定義で、本体より前が変わっていなければ、その本体だけを
+// パースし直し、ほかの宣言の Obj と構文木はそのまま使う。そうでなければ、
+// 後ろの宣言の意味も変わりうるので、ファイルスコープを読み直した宣言の手前
+// まで巻き戻し、後ろの宣言をすべてパースし直す（トークナイズはし直さない）。
+//
+// プリプロセッサの状態は巻き戻せないので、読み直せるのは入力ファイルの最後の
+// ディレクティブより後ろだけである。
+//
+
+// トップレベルの宣言ひとつ分の情報
+typedef struct {
+    Token *tok;         // 宣言のトークン（TK_EOF で終端）
+    int start;          // 最初のトークンの位置。マクロ展開の結果であれば -1
+    int end;            // 入力ファイルをどこまで読んだか。直前の宣言の end
+                        // からここまでを、この宣言の範囲とする
+    bool clean;         // 読み終えたときにマクロ展開の途中でなければ真
+    int errors;         // パースしたときに報告したエラーの数
+    Obj *fn;            // 関数定義であればその関数
+    uint64_t header;    // 関数定義であれば、本体より前のトークンのハッシュ値
+    Obj *globals;       // この宣言で作ったグローバル変数（新しいものが先頭）
+    Obj *globals_last;  // そのリストの末尾
+    Arena arena;        // ファイルスコープのオブジェクトの領域
+    Arena body;         // 関数の本体の領域
+
+    // パースする直前のファイルスコープの状態。巻き戻すときに使う
+    VarScope *vars;
+    TagScope *tags;
+    int unique_id;
+
+    int unique_end;     // パースし終えたときの unique_id
+} TopDecl;
+
+static TopDecl *decls;
+static int decls_cnt;
+static int decls_cap;
+
+// 入力ファイルのこの位置より前は読み直せない
+static int reparse_limit;
+
+static void reserve_decls(int cnt) {
+    if (cnt <= decls_cap)
+        return;
+    while (decls_cap < cnt)
+        decls_cap = decls_cap ? decls_cap * 2 : 256;
+    decls = realloc(decls, sizeof(TopDecl) * decls_cap);
+}
+
+// read_toplevel が返したトークンから宣言の情報を作る。`prev_end` は直前の
+// 宣言の終わり
+static TopDecl new_top_decl(Token *tok, int prev_end) {
+    File *file = get_input_files()[0];
+    TopDecl d = {.tok = tok, .start = -1};
+    d.end = read_position() - file->contents;
+    d.clean = !expansion_pending();
+    if (tok->file == file && tok->loc >= file->contents + prev_end)
+        d.start = tok->loc - file->contents;
+    return d;
+}
+
+// 関数定義のトークンのうち、本体を始める "{" を返す。read_toplevel と同じく、
+// ")" の直後の "{" を本体の始まりとみなす
+static Token *body_start(Token *tok) {
+    int depth = 0;
+    for (Token *prev = NULL; tok->kind != TK_EOF; prev = tok, tok = tok->next) {
+        if (tok->id == '{' && depth == 0 && prev && prev->id == ')')
+            return tok;
+        if (tok->id == '{')
+            depth++;
+        else if (tok->id == '}')
+            depth--;
+    }
+    return NULL;
+}
+
+// 宣言 `d` をパースする。`body` が NULL でなければ、関数定義の本体 `body`
+// だけをパースし直す
+static void parse_top_decl(TopDecl *d, Token *body) {
+    char **names = NULL;
+
+    if (body) {
+        // 仮引数の名前は前の本体から引き継ぐ
+        Obj *fn = d->fn;
+        names = calloc(fn->ty->param_cnt + 1, sizeof(char *));
+        Obj *var = fn->params;
+        for (int i = 0; i < fn->ty->param_cnt; i++, var = var->next)
+            names[i] = var->name;
+        arena_release(&d->body);
+        fn->params = fn->locals = NULL;
+        fn->body = NULL;
+        fn->next = NULL;
+        globals = fn;
+    } else {
+        d->vars = scope->vars;
+        d->tags = scope->tags;
+        d->unique_id = unique_id;
+        d->fn = NULL;
+        globals = NULL;
+    }
+
+    fn_arena = file_arena = &d->arena;
+    body_arena = &d->body;
+    int errors = error_cnt;
+
+    jmp_buf jmp;
+    ParserState state = save_state();
+    if (setjmp(jmp)) {
+        restore_state(state);
+        locals = NULL;
+    } else {
+        error_recovery = &jmp;
+        if (body)
+            function_body(body, d->fn, names);
+        else
+            d->fn = toplevel(d->tok);
+    }
+    error_recovery = NULL;
+    free(names);
+    d->errors = error_cnt - errors;
+
+    fn_arena = file_arena = &perm_arena;
+    body_arena = &ast_arena;
+
+    d->globals = d->globals_last = globals;
+    while (d->globals_last && d->globals_last->next)
+        d->globals_last = d->globals_last->next;
+    if (d->fn && !body)
+        d->header = hash_tokens(d->tok, body_start(d->tok));
+    d->unique_end = unique_id;
+}
+
+// ファイルスコープを、宣言 `d` をパースする直前の状態に戻す
+static void rewind_file_scope(TopDecl *d) {
+    while (scope->vars != d->vars) {
+        VarScope *sc = scope->vars;
+        get_binding(sc->name)->var = sc->shadow;
+        scope->vars = sc->next;
+    }
+    while (scope->tags != d->tags) {
+        TagScope *sc = scope->tags;
+        get_binding(sc->name)->tag = sc->shadow;
+        scope->tags = sc->next;
+    }
+
+    // 前の宣言の本体をパースし直したときに使った名前とは重ならないようにする
+    unique_id = d->unique_id;
+    for (TopDecl *e = decls; e < d; e++)
+        if (unique_id < e->unique_end)
+            unique_id = e->unique_end;
+}
+
+// 宣言ごとのグローバル変数のリストをつなげて、プログラム全体のリストを返す
+static Obj *link_globals(void) {
+    Obj *head = NULL;
+    for (int i = 0; i < decls_cnt; i++) {
+        TopDecl *d = &decls[i];
+        if (!d->globals)
+            continue;
+        d->globals_last->next = head;
+        head = d->globals;
+    }
+    return head;
+}
+
+// 入力ファイルの編集に合わせて、宣言のトークンの位置を付け替える。元の内容の
+// `edit_end` より前を指すトークンは `diff` だけずらし、後ろを指すトークンは
+// さらに `delta` だけずらして、行番号を `lines` だけずらす
+static void move_tokens(TopDecl *d, File *file, char *edit_end, ptrdiff_t diff,
+                        int delta, int lines) {
+    for (Token *tok = d->tok;; tok = tok->next) {
+        if (tok->file == file) {
+            if (tok->loc >= edit_end) {
+                tok->loc += diff + delta;
+                tok->line_no += lines;
+            } else {
+                tok->loc += diff;
+            }
+        }
+        if (tok->kind == TK_EOF)
+            return;
+    }
+}
+
+static int count_lines(char *p, int len) {
+    int n = 0;
+    for (char *end = p + len; (p = memchr(p, '\n', end - p)); p++)
+        n++;
+    return n;
+}
+
+// 入力全体をパースする。parse と違い、増分パースに備えてトークンと構文木を
+// 宣言ごとにすべて保持しておく。返すグローバル変数のリストに含まれる関数は
+// 本体を持つ。エラーがあっても終了せず、報告したエラーの数を error_cnt に
+// 残す。エラーを含む宣言は、編集して直したときにパースし直される。
+Obj *parse_retained(void) {
+    File *file = get_input_files()[0];
+    int prev_end = 0;
+
+    for (;;) {
+        Token *tok = read_toplevel();
+        if (tok->kind == TK_EOF) {
+            release_tokens(tok);
+            break;
+        }
+        reserve_decls(decls_cnt + 1);
+        TopDecl *d = &decls[decls_cnt++];
+        *d = new_top_decl(tok, prev_end);
+        prev_end = d->end;
+        parse_top_decl(d, NULL);
+    }
+
+    char *p = last_directive_end();
+    reparse_limit = p ? p - file->contents : 0;
+    return link_globals();
+}
+
+// 入力ファイルの [start, end) バイト目を長さ len の `text` で置き換えて、
+// パースし直す。parse_retained の後に何度でも呼べる。返すリストは
+// parse_retained と同じく、編集の及ばない宣言の Obj と構文木はそのまま使う。
+// 最後のディレクティブより前を編集する場合や、"#" を書き加える場合は、
+// 増分パースできないので NULL を返す。error_cnt には、まだ直って
+// いない宣言が報告したエラーの数が入る。
+Obj *reparse(int start, int end, char *text, int len) {
+    File *file = get_input_files()[0];
+    char *old = file->contents;
+    int size = strlen(old);
+
+    if (start < 0 || start > end || end > size)
+        error("編集の範囲が正しくありません: %d-%d", start, end);
+    if (memchr(text, '#', len))
+        return NULL;
+
+    // 編集を含む最初の宣言から読み直す。マクロ展開の途中で区切られた
+    // 宣言の間からは読み直せないので、その並びの先頭まで戻る
+    int first = 0;
+    while (first < decls_cnt && decls[first].end <= start)
+        first++;
+    while (first > 0 && !decls[first - 1].clean)
+        first--;
+
+    // 宣言の前の空白やコメントはその宣言に含めるが、ディレクティブは含めない
+    int from = first ? decls[first - 1].end : 0;
+    if (from < reparse_limit) {
+        int tok_start = first < decls_cnt ? decls[first].start : size;
+        if (tok_start < reparse_limit)
+            return NULL;
+        from = reparse_limit;
+    }
+    if (start < from)
+        return NULL;
+
+    error_cnt = 0;
+    int delta = len - (end - start);
+    int lines = count_lines(text, len) - count_lines(old + start, end - start);
+    char *buf = edit_token_stream(start, end, text, len, from);
+    ptrdiff_t diff = buf - old;
+
+    // 読み直すときに展開するマクロの本体も、新しい内容を指すようにしておく
+    if (diff)
+        move_macros(old, old + from, buf);
+    char *directives = last_directive_end();
+
+    // 読み直した宣言の区切りが、編集より後ろにある元の宣言の区切りと一致
+    // したら止める。そこから後ろのトークンは元のものと変わらない。
+    // 置き換える元の宣言は [first, last) である
+    TopDecl *fresh = NULL;
+    int nfresh = 0;
+    int last = decls_cnt;
+    int prev_end = from;
+
+    for (int k = first;;) {
+        Token *tok = read_toplevel();
+        if (tok->kind == TK_EOF) {
+            release_tokens(tok);
+            break;
+        }
+
+        fresh = realloc(fresh, sizeof(TopDecl) * (nfresh + 1));
+        TopDecl *d = &fresh[nfresh++];
+        *d = new_top_decl(tok, prev_end);
+        prev_end = d->end;
+
+        while (k < decls_cnt && (decls[k].end < end || decls[k].end + delta < d->end))
+            k++;
+        if (k < decls_cnt && decls[k].end + delta == d->end && decls[k].clean && d->clean) {
+            last = k + 1;
+            break;
+        }
+    }
+
+    if (last_directive_end() != directives)
+        error("増分パースではディレクティブを書き加えられません");
+
+    // 読み直さなかった宣言のトークンの位置を付け替える
+    if (diff)
+        for (int i = 0; i < first; i++)
+            move_tokens(&decls[i], file, old + size + 1, diff, 0, 0);
+    for (int i = last; i < decls_cnt; i++) {
+        move_tokens(&decls[i], file, old + end, diff, delta, lines);
+        decls[i].end += delta;
+        if (decls[i].start >= 0)
+            decls[i].start += delta;
+    }
+
+    // 関数定義の本体だけが変わったのであれば、その本体だけをパースし直す
+    bool bodies_only = nfresh == last - first;
+    for (int i = 0; i < nfresh && bodies_only; i++) {
+        Token *body = body_start(fresh[i].tok);
+        bodies_only = !decls[first + i].errors && decls[first + i].fn && body &&
+                      hash_tokens(fresh[i].tok, body) == decls[first + i].header;
+    }
+
+    if (bodies_only) {
+        for (int i = 0; i < nfresh; i++) {
+            TopDecl *d = &decls[first + i];
+            release_tokens(d->tok);
+            d->tok = fresh[i].tok;
+            d->start = fresh[i].start;
+            d->end = fresh[i].end;
+            d->clean = fresh[i].clean;
+            parse_top_decl(d, body_start(d->tok));
+        }
+    } else {
+        if (first < decls_cnt)
+            rewind_file_scope(&decls[first]);
+        for (int i = first; i < decls_cnt; i++) {
+            if (i < last)
+                release_tokens(decls[i].tok);
+            arena_release(&decls[i].arena);
+            arena_release(&decls[i].body);
+        }
+
+        int rest = decls_cnt - last;
+        reserve_decls(first + nfresh + rest);
+        memmove(&decls[first + nfresh], &decls[last], sizeof(TopDecl) * rest);
+        memcpy(&decls[first], fresh, sizeof(TopDecl) * nfresh);
+        decls_cnt = first + nfresh + rest;
+
+        for (int i = first; i < decls_cnt; i++)
+            parse_top_decl(&decls[i], NULL);
+    }
+    free(fresh);
+
+    // 読み直さなかった宣言に残っているエラーも数える
+    error_cnt = 0;
+    for (int i = 0; i < decls_cnt; i++)
+        error_cnt += decls[i].errors;
+    return link_globals();
+}
+
+//
+// 宣言の一覧
+//
+// --declarations-only では、関数の本体を読み飛ばしてファイルスコープの宣言
+// だけをパースし、その名前と型を cdecl 風の英語で一行ずつ出力する。例えば
+//
+//   declare buf as array 16 of char
+//   define main as function () returning int
+//
+
+// 関数の本体を読み飛ばすようにする
+void skip_function_bodies(void) {
+    skip_bodies = true;
+}
+
+// 読み飛ばした関数 `fn` の本体を入力ファイルから読み直してパースし、fn の
+// params、body、locals を設定する。parse の後に、必要な関数についてだけ
+// 呼べばよい。構文木は ast_arena から確保するので、使い終えたら解放できる。
+// 名前は、ファイルスコープをすべてパースし終えた時点のスコープで探す。
+//
+// 本体の中の文字列リテラルはグローバル変数になるので、グローバル変数の
+// リストを返す。本体にディレクティブがある場合や、読み飛ばした後で定義
+// されたマクロによって本体のトークンが変わった場合は、読み直せないので
+// NULL を返す。
+Obj *parse_function_body(Obj *fn) {
+    LazyBody *lazy = fn->lazy;
+    if (!lazy)
+        return NULL;
+
+    Token *tok = reread_block(lazy->loc);
+    if (!tok)
+        return NULL;
+    if (hash_tokens(tok, NULL) != lazy->hash) {
+        release_tokens(tok);
+        return NULL;
+    }
+
+    // 構文木はトークンを参照しているので、前に読み直したトークンは
+    // ここで解放する
+    if (lazy->tok)
+        release_tokens(lazy->tok);
+    lazy->tok = tok;
+    function_body(tok, fn, lazy->param_names);
+    return globals;
+}
+
+// parse_function_body でパースした本体を使い終えたら、そのトークンを解放する。
+// 構文木は ast_arena にあるので、呼び出し側で解放すること
+void release_function_body(Obj *fn) {
+    fn->params = fn->locals = NULL;
+    fn->body = NULL;
+    if (fn->lazy && fn->lazy->tok) {
+        release_tokens(fn->lazy->tok);
+        fn->lazy->tok = NULL;
+    }
+}
+
+static void print_type(FILE *out, Type *ty) {
+    switch (ty->kind) {
+    case TY_VOID:
+        fprintf(out, "void");
+        return;
+    case TY_CHAR:
+        fprintf(out, "char");
+        return;
+    case TY_SHORT:
+        fprintf(out, "short");
+        return;
+    case TY_INT:
+        fprintf(out, "int");
+        return;
+    case TY_LONG:
+        fprintf(out, "long");
+        return;
+    case TY_PTR:
+        fprintf(out, "pointer to ");
+        print_type(out, ty->base);
+        return;
+    case TY_ARRAY:
+        fprintf(out, "array %d of ", ty->array_len);
+        print_type(out, ty->base);
+        return;
+    case TY_FUNC:
+        fprintf(out, "function (");
+        for (int i = 0; i < ty->param_cnt; i++) {
+            if (i)
+                fprintf(out, ", ");
+            print_type(out, ty->params[i]);
+        }
+        fprintf(out, ") returning ");
+        print_type(out, ty->return_ty);
+        return;
+    case TY_STRUCT:
+    case TY_UNION:
+        fprintf(out, ty->kind == TY_STRUCT ? "struct {" : "union {");
+        for (Member *mem = ty->members; mem; mem = mem->next) {
+            fprintf(out, " %s as ", mem->name);
+            print_type(out, mem->ty);
+            fprintf(out, ";");
+        }
+        fprintf(out, " }");
+        return;
+    }
+}
+
+// ファイルスコープの宣言を、宣言された順に出力する
+void print_declarations(FILE *out) {
+    int n = 0;
+    for (VarScope *sc = scope->vars; sc; sc = sc->next)
+        n++;
+
+    // スコープの宣言は新しいものから並んでいるので、逆順に並べ直す
+    VarScope **decls = calloc(n, sizeof(VarScope *));
+    int i = n;
+    for (VarScope *sc = scope->vars; sc; sc = sc->next)
+        decls[--i] = sc;
+
+    for (i = 0; i < n; i++) {
+        VarScope *sc = decls[i];
+        if (sc->type_def)
+            fprintf(out, "typedef %s as ", sc->name);
+        else if (sc->var->is_function && sc->var->is_definition)
+            fprintf(out, "define %s as ", sc->name);
+        else
+            fprintf(out, "declare %s as ", sc->name);
+        print_type(out, sc->type_def ? sc->type_def : sc->var->ty);
+        fprintf(out, "\n");
+    }
+    free(decls);
+}
+
+// パーサの状態を初期状態に戻す（reset_compiler を参照）。スコープ、グローバル
+// 変数、スナップショット、増分パースの宣言の表を捨てる
+void reset_parser(void) {
+    while (scope->next)
+        scope = scope->next;
+    scope->vars = NULL;
+    scope->tags = NULL;
+    globals = locals = NULL;
+    fn_arena = file_arena = &perm_arena;
+    body_arena = &ast_arena;
+    skip_bodies = false;
+    unique_id = 0;
+    emit_function = NULL;
+
+    free(operands);
+    free(operators);
+    operands = NULL;
+    operators = NULL;
+    operands_len = operands_cap = operators_len = operators_cap = 0;
+
+    prefix_out = NULL;
+    free(out_hashes);
+    out_hashes = NULL;
+    out_hashes_cnt = 0;
+    free(prefix_in.data);
+    memset(&prefix_in, 0, sizeof(prefix_in));
+
+    for (int i = 0; i < decls_cnt; i++) {
+        arena_release(&decls[i].arena);
+        arena_release(&decls[i].body);
+    }
+    free(decls);
+    decls = NULL;
+    decls_cnt = decls_cap = reparse_limit = 0;
+}
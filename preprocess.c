@@ -0,0 +1,1278 @@
+// プリプロセッサ
+//
+// トークナイザから受け取ったトークンに対して、ディレクティブの処理と
+// マクロ展開を行い、パーサに渡す。入力全体を一度に処理するのではなく、
+// パーサが read_toplevel でトークンを要求するたびに必要な分だけ処理する。
+//
+// マクロ展開の結果や展開途中のトークンは「コンテキスト」のスタックに積み、
+// コンテキストが空のときだけ入力ファイルからトークンを読む。展開中のマクロは
+// 無効にしておき、その名前のトークンは二度と展開しないよう印を付ける。
+//
+// インクルードしたヘッダはトークナイズした結果をキャッシュしておき、
+// 同じヘッダを再びインクルードしたときはトークンを複製するだけで済ませる。
+// さらに、インクルードガードや #pragma once を持つヘッダは、
+// ２回目以降はキャッシュを読むことすらせずに読み飛ばす。
+
+#include "chibicc.h"
+#include <libgen.h>
+
+typedef struct {
+    char *name;       // マクロ名
+    bool is_objlike;  // オブジェクト形式のマクロであれば真
+    int nparams;      // 仮引数の数（... を含む）
+    bool is_variadic; // 可変長引数を取るマクロであれば真
+    Token *body;      // 置換リスト（NULL 終端）。仮引数のトークンの val は
+                      // 仮引数の番号に1を足した値
+    bool disabled;    // 展開中であれば真
+} Macro;
+
+// マクロ展開の結果などの、ファイル以外からトークンを読むための文脈
+typedef struct Context Context;
+struct Context {
+    Context *next;
+    Token *tok;   // 次に読むトークン（NULL 終端）
+    Macro *macro; // マクロ展開の結果であれば、そのマクロ
+};
+
+// #if から #endif までの条件付きの範囲
+typedef struct CondIncl CondIncl;
+struct CondIncl {
+    CondIncl *next;
+    enum { IN_THEN, IN_ELIF, IN_ELSE } ctx;
+    Token *tok;    // ディレクティブの位置（エラー報告用）
+    bool included; // いずれかの節がすでに採用されていれば真
+};
+
+// トークナイズしたヘッダのキャッシュ
+typedef struct {
+    Token *tokens; // ヘッダのトークン（TK_EOF で終端）
+    char *guard;   // インクルードガードのマクロ名。なければ NULL
+    bool once;     // #pragma once があれば真
+} Header;
+
+// トークンを読んでいるファイル。インクルードのたびに積まれる。
+typedef struct Source Source;
+struct Source {
+    Source *next;
+    Header *hdr;     // ヘッダであればそのキャッシュ。入力ファイルなら NULL
+    Token *tok;      // ヘッダの次に読むトークン
+    Token *ahead;    // 読み戻したトークンのスタック
+    CondIncl *cond;  // ファイルに入った時点の条件付きの範囲
+};
+
+static HashMap macros;
+static HashMap headers;
+
+static Context *contexts;
+
+// マクロの実引数を展開している間は真。このときはコンテキストが空になっても
+// ファイルを読まない。
+static bool in_arg;
+
+static CondIncl *cond_incl;
+
+static Source main_source;
+static Source *sources = &main_source;
+
+static char **include_paths;
+static int include_paths_cnt;
+
+static char *va_args_atom;
+
+// 入力ファイルで最後に処理したディレクティブの、次の行の先頭のトークンの位置
+static char *directives_end;
+
+// reread_block で読み直している間は真。ディレクティブに出会ったら
+// reread_failed を真にして、処理せずに入力の終わりとする
+static bool rereading;
+static bool reread_failed;
+
+static Token *read_expanded(void);
+static Token *expand_arg(Token *arg);
+
+void add_include_path(char *dir) {
+    include_paths = realloc(include_paths, sizeof(char *) * (include_paths_cnt + 1));
+    include_paths[include_paths_cnt++] = dir;
+}
+
+// `tok` の直後を指す TK_EOF のトークンを作る
+static Token *new_eof(Token *tok) {
+    Token *t = copy_token(tok);
+    t->kind = TK_EOF;
+    t->id = ID_NONE;
+    t->loc = tok->loc + tok->len;
+    t->len = 0;
+    return t;
+}
+
+static bool is_hash(Token *tok) {
+    return tok->at_bol && tok->id == '#';
+}
+
+static void free_list(Token *tok) {
+    while (tok) {
+        Token *next = tok->next;
+        free_token(tok);
+        tok = next;
+    }
+}
+
+static Token *copy_list(Token *tok) {
+    Token head = {};
+    Token *cur = &head;
+    for (; tok; tok = tok->next) {
+        cur = cur->next = copy_token(tok);
+        cur->at_bol = false;
+    }
+    return head.next;
+}
+
+//
+// ファイルからの読み込み
+//
+
+// 現在のファイルから次のトークンを読む。ファイルの終わりでは TK_EOF を返す。
+static Token *file_token(void) {
+    Source *src = sources;
+    if (src->ahead) {
+        Token *tok = src->ahead;
+        src->ahead = tok->next;
+        tok->next = NULL;
+        return tok;
+    }
+
+    if (!src->hdr)
+        return read_token();
+
+    // キャッシュ中のトークンは複製して渡す
+    Token *tok = copy_token(src->tok);
+    if (src->tok->kind != TK_EOF)
+        src->tok = src->tok->next;
+    return tok;
+}
+
+static void unget_file_token(Token *tok) {
+    tok->next = sources->ahead;
+    sources->ahead = tok;
+}
+
+// ディレクティブの残りのトークンを、行の終わりまで読んで返す
+static Token *read_line(void) {
+    Token head = {};
+    Token *cur = &head;
+    for (;;) {
+        Token *tok = file_token();
+        if (tok->at_bol || tok->kind == TK_EOF) {
+            unget_file_token(tok);
+            break;
+        }
+        cur = cur->next = tok;
+    }
+    cur->next = NULL;
+    return head.next;
+}
+
+// ヘッダの終わりに達したら、インクルードしたファイルに戻る
+static void pop_source(void) {
+    Source *src = sources;
+    if (cond_incl != src->cond)
+        error_tok(cond_incl->tok, "#endif がありません");
+    sources = src->next;
+    free(src);
+}
+
+//
+// 条件付きの範囲
+//
+
+static void push_cond_incl(Token *tok, bool included) {
+    CondIncl *ci = calloc(1, sizeof(CondIncl));
+    ci->next = cond_incl;
+    ci->ctx = IN_THEN;
+    ci->tok = tok;
+    ci->included = included;
+    cond_incl = ci;
+}
+
+// 採用しない節を、対応する #elif, #else, #endif の直前まで読み飛ばす。
+// 読み飛ばしたトークンは解放する。
+static void skip_cond_incl(void) {
+    int depth = 0;
+    for (;;) {
+        Token *tok = file_token();
+        if (tok->kind == TK_EOF) {
+            unget_file_token(tok);
+            return;
+        }
+        if (!is_hash(tok)) {
+            free_token(tok);
+            continue;
+        }
+
+        Token *name = file_token();
+        if (equal(name, "if") || equal(name, "ifdef") || equal(name, "ifndef")) {
+            depth++;
+        } else if (equal(name, "elif") || equal(name, "else") || equal(name, "endif")) {
+            if (depth == 0) {
+                unget_file_token(name);
+                unget_file_token(tok);
+                return;
+            }
+            if (equal(name, "endif"))
+                depth--;
+        }
+        free_token(tok);
+        unget_file_token(name);
+    }
+}
+
+//
+// #if の定数式
+//
+// 加減乗算のオーバーフローは、定数の畳み込みと同じく 2 の補数で折り返す
+//
+
+static int64_t eval_cond(Token **rest, Token *tok);
+
+static int64_t eval_primary(Token **rest, Token *tok) {
+    if (tok->id == '(') {
+        int64_t val = eval_cond(&tok, tok->next);
+        *rest = skip(tok, ")");
+        return val;
+    }
+
+    if (tok->kind == TK_NUM) {
+        *rest = tok->next;
+        return tok->val;
+    }
+
+    // 展開されずに残った識別子は 0 とみなす
+    if (tok->kind == TK_IDENT || tok->kind == TK_KEYWORD) {
+        *rest = tok->next;
+        return 0;
+    }
+
+    error_tok(tok, "不正な定数式です");
+}
+
+static int64_t eval_unary(Token **rest, Token *tok) {
+    if (tok->id == '+')
+        return eval_unary(rest, tok->next);
+    if (tok->id == '-')
+        return -(uint64_t)eval_unary(rest, tok->next);
+    if (tok->id == '!')
+        return !eval_unary(rest, tok->next);
+    return eval_primary(rest, tok);
+}
+
+static int64_t eval_mul(Token **rest, Token *tok) {
+    int64_t val = eval_unary(&tok, tok);
+    for (;;) {
+        Token *start = tok;
+        if (tok->id == '*') {
+            val = (uint64_t)val * eval_unary(&tok, tok->next);
+            continue;
+        }
+        if (tok->id == '/' || tok->id == '%') {
+            int64_t rhs = eval_unary(&tok, tok->next);
+            if (rhs == 0)
+                error_tok(start, "ゼロで除算しています");
+            if (val == INT64_MIN && rhs == -1)
+                error_tok(start, "除算がオーバーフローしています");
+            val = start->id == '/' ? val / rhs : val % rhs;
+            continue;
+        }
+        *rest = tok;
+        return val;
+    }
+}
+
+static int64_t eval_add(Token **rest, Token *tok) {
+    int64_t val = eval_mul(&tok, tok);
+    for (;;) {
+        if (tok->id == '+') {
+            val = (uint64_t)val + eval_mul(&tok, tok->next);
+            continue;
+        }
+        if (tok->id == '-') {
+            val = (uint64_t)val - eval_mul(&tok, tok->next);
+            continue;
+        }
+        *rest = tok;
+        return val;
+    }
+}
+
+static int64_t eval_relational(Token **rest, Token *tok) {
+    int64_t val = eval_add(&tok, tok);
+    for (;;) {
+        if (tok->id == '<') {
+            val = val < eval_add(&tok, tok->next);
+            continue;
+        }
+        if (tok->id == PU_LE) {
+            val = val <= eval_add(&tok, tok->next);
+            continue;
+        }
+        if (tok->id == '>') {
+            val = val > eval_add(&tok, tok->next);
+            continue;
+        }
+        if (tok->id == PU_GE) {
+            val = val >= eval_add(&tok, tok->next);
+            continue;
+        }
+        *rest = tok;
+        return val;
+    }
+}
+
+static int64_t eval_equality(Token **rest, Token *tok) {
+    int64_t val = eval_relational(&tok, tok);
+    for (;;) {
+        if (tok->id == PU_EQ) {
+            val = val == eval_relational(&tok, tok->next);
+            continue;
+        }
+        if (tok->id == PU_NE) {
+            val = val != eval_relational(&tok, tok->next);
+            continue;
+        }
+        *rest = tok;
+        return val;
+    }
+}
+
+static int64_t eval_logand(Token **rest, Token *tok) {
+    int64_t val = eval_equality(&tok, tok);
+    while (tok->id == PU_LOGAND) {
+        int64_t rhs = eval_equality(&tok, tok->next);
+        val = val && rhs;
+    }
+    *rest = tok;
+    return val;
+}
+
+static int64_t eval_logor(Token **rest, Token *tok) {
+    int64_t val = eval_logand(&tok, tok);
+    while (tok->id == PU_LOGOR) {
+        int64_t rhs = eval_logand(&tok, tok->next);
+        val = val || rhs;
+    }
+    *rest = tok;
+    return val;
+}
+
+// cond = logor ("?" cond ":" cond)?
+static int64_t eval_cond(Token **rest, Token *tok) {
+    int64_t val = eval_logor(&tok, tok);
+    if (tok->id != '?') {
+        *rest = tok;
+        return val;
+    }
+    int64_t then = eval_cond(&tok, tok->next);
+    tok = skip(tok, ":");
+    int64_t els = eval_cond(rest, tok);
+    return val ? then : els;
+}
+
+// defined 演算子を 0 か 1 の数値に置き換えたリストを返す
+static Token *replace_defined(Token *tok) {
+    Token head = {};
+    Token *cur = &head;
+
+    while (tok) {
+        if (!equal(tok, "defined")) {
+            cur = cur->next = tok;
+            tok = tok->next;
+            continue;
+        }
+
+        Token *start = tok;
+        tok = tok->next;
+        bool paren = tok && tok->id == '(';
+        if (paren)
+            tok = tok->next;
+        if (!tok || (tok->kind != TK_IDENT && tok->kind != TK_KEYWORD))
+            error_tok(start, "defined の後にはマクロ名が必要です");
+        bool defined = hashmap_get2(&macros, tok->loc, tok->len);
+        tok = tok->next;
+        if (paren) {
+            if (!tok || tok->id != ')')
+                error_tok(start, "defined の ( が閉じていません");
+            tok = tok->next;
+        }
+
+        // 置き換えたトークンは解放する
+        Token *num = copy_token(start);
+        num->kind = TK_NUM;
+        num->id = ID_NONE;
+        num->val = defined;
+        for (Token *t = start; t != tok;) {
+            Token *next = t->next;
+            free_token(t);
+            t = next;
+        }
+        cur = cur->next = num;
+    }
+    cur->next = NULL;
+    return head.next;
+}
+
+// #if, #elif の条件を読んで評価する
+static bool read_const_expr(Token *hash) {
+    Token *line = replace_defined(read_line());
+    if (!line)
+        error_tok(hash, "条件式がありません");
+
+    Token *expanded = expand_arg(line);
+    free_list(line);
+    if (!expanded)
+        error_tok(hash, "条件式がありません");
+
+    Token *last = expanded;
+    while (last->next)
+        last = last->next;
+    last->next = new_eof(last);
+
+    Token *tok;
+    int64_t val = eval_cond(&tok, expanded);
+    if (tok->kind != TK_EOF)
+        error_tok(tok, "余分なトークンがあります");
+    release_tokens(expanded);
+    return val;
+}
+
+//
+// マクロ
+//
+
+// 仮引数のトークンであれば仮引数の番号を、そうでなければ -1 を返す
+static int param_index(Token *tok) {
+    return tok && tok->kind == TK_IDENT ? tok->val - 1 : -1;
+}
+
+static void read_macro_definition(Token *hash) {
+    Token *name = file_token();
+    if (name->at_bol || (name->kind != TK_IDENT && name->kind != TK_KEYWORD))
+        error_tok(name, "マクロ名が必要です");
+
+    Macro *m = arena_alloc(&perm_arena, sizeof(Macro));
+    m->name = name->kind == TK_IDENT ? name->str : arena_strndup(&perm_arena, name->loc, name->len);
+    Token *body = read_line();
+
+    // 名前の直後に空白なしで "(" が続けば関数形式のマクロ
+    char **params = NULL;
+    if (body && body->id == '(' && !body->has_space) {
+        Token *tok = body->next;
+        while (tok && tok->id != ')') {
+            if (m->nparams > 0)
+                tok = skip(tok, ",");
+            if (!tok)
+                break;
+
+            params = realloc(params, sizeof(char *) * (m->nparams + 1));
+            if (tok->id == PU_ELLIPSIS) {
+                m->is_variadic = true;
+                params[m->nparams++] = va_args_atom;
+                tok = tok->next;
+                break;
+            }
+            if (tok->kind != TK_IDENT)
+                error_tok(tok, "仮引数名が必要です");
+            params[m->nparams++] = tok->str;
+            tok = tok->next;
+        }
+        if (!tok || tok->id != ')')
+            error_tok(name, "マクロの仮引数リストが閉じていません");
+
+        Token *start = body;
+        body = tok->next;
+        tok->next = NULL;
+        free_list(start);
+    } else {
+        m->is_objlike = true;
+    }
+
+    // 置換リストの仮引数に番号を振っておく
+    for (Token *tok = body; tok; tok = tok->next) {
+        tok->at_bol = false;
+        if (tok->kind != TK_IDENT)
+            continue;
+        for (int i = 0; i < m->nparams; i++)
+            if (params[i] == tok->str)
+                tok->val = i + 1;
+    }
+    free(params);
+
+    m->body = body;
+    hashmap_put(&macros, m->name, m);
+    free_token(name);
+}
+
+static Macro *find_macro(Token *tok) {
+    if (tok->kind != TK_IDENT && tok->kind != TK_KEYWORD)
+        return NULL;
+    if (!macros.used)
+        return NULL;
+    return hashmap_get2(&macros, tok->loc, tok->len);
+}
+
+static void push_context(Token *tok, Macro *m) {
+    Context *ctx = calloc(1, sizeof(Context));
+    ctx->next = contexts;
+    ctx->tok = tok;
+    ctx->macro = m;
+    contexts = ctx;
+    if (m)
+        m->disabled = true;
+}
+
+// トークンを１つ、マクロ展開せずに読む。ディレクティブはここで処理する。
+// マクロの実引数を展開していて、その実引数を読み終えたら NULL を返す。
+static void directive(Token *hash);
+
+static Token *read_unexpanded(void) {
+    for (;;) {
+        if (contexts) {
+            Context *ctx = contexts;
+            if (ctx->tok) {
+                Token *tok = ctx->tok;
+                ctx->tok = tok->next;
+                tok->next = NULL;
+                return tok;
+            }
+            if (ctx->macro)
+                ctx->macro->disabled = false;
+            contexts = ctx->next;
+            free(ctx);
+            continue;
+        }
+
+        if (in_arg)
+            return NULL;
+
+        Token *tok = file_token();
+        if (tok->kind == TK_EOF && sources->hdr) {
+            free_token(tok);
+            pop_source();
+            continue;
+        }
+        if (is_hash(tok) && rereading) {
+            reread_failed = true;
+            Token *eof = new_eof(tok);
+            free_token(tok);
+            return eof;
+        }
+        if (is_hash(tok)) {
+            bool in_main = sources == &main_source;
+            directive(tok);
+            if (in_main)
+                directives_end = main_source.ahead ? main_source.ahead->loc : token_stream_pos();
+            continue;
+        }
+        tok->next = NULL;
+        return tok;
+    }
+}
+
+static void unget(Token *tok) {
+    tok->next = NULL;
+    push_context(tok, NULL);
+}
+
+// 文字列をエスケープしてダブルクォートで囲む
+static char *quote_string(char *str) {
+    int bufsize = 3;
+    for (int i = 0; str[i]; i++) {
+        if (str[i] == '\\' || str[i] == '"')
+            bufsize++;
+        bufsize++;
+    }
+
+    char *buf = calloc(1, bufsize);
+    int pos = 0;
+    buf[pos++] = '"';
+    for (int i = 0; str[i]; i++) {
+        if (str[i] == '\\' || str[i] == '"')
+            buf[pos++] = '\\';
+        buf[pos++] = str[i];
+    }
+    buf[pos++] = '"';
+    buf[pos++] = '\0';
+    return buf;
+}
+
+// 文字列をトークナイズし、ちょうど１つのトークンになればそれを返す。
+// そうでなければ NULL を返す。トークンは文字列を指し続けるので、
+// 文字列は perm_arena に写しておく
+static Token *tokenize_one(char *buf, Token *tmpl) {
+    buf = arena_strndup(&perm_arena, buf, strlen(buf));
+    File *file = new_file(tmpl->file->name, tmpl->file->file_no, buf);
+    Token *tok = tokenize(file);
+    if (tok->kind == TK_EOF || tok->next->kind != TK_EOF) {
+        release_tokens(tok);
+        return NULL;
+    }
+    free_token(tok->next);
+    tok->next = NULL;
+    tok->at_bol = false;
+    tok->has_space = tmpl->has_space;
+    return tok;
+}
+
+// トークン列のつづりをつなげた文字列を返す。トークンの間の空白は
+// １つの空白にまとめる
+static char *join_tokens(Token *tok) {
+    int len = 0;
+    for (Token *t = tok; t; t = t->next)
+        len += t->len + 1;
+
+    char *buf = calloc(1, len + 1);
+    int pos = 0;
+    for (Token *t = tok; t; t = t->next) {
+        if (t != tok && t->has_space)
+            buf[pos++] = ' ';
+        memcpy(buf + pos, t->loc, t->len);
+        pos += t->len;
+    }
+    return buf;
+}
+
+// # 演算子。実引数のつづりを文字列リテラルにする。
+static Token *stringize(Token *hash, Token *arg) {
+    char *buf = join_tokens(arg);
+    char *str = quote_string(buf);
+    Token *tok = tokenize_one(str, hash);
+    free(str);
+    free(buf);
+    return tok;
+}
+
+// ## 演算子。`lhs` を `lhs` と `rhs` を連結したトークンで置き換える。
+static void paste(Token *lhs, Token *rhs) {
+    char *buf = format("%.*s%.*s", lhs->len, lhs->loc, rhs->len, rhs->loc);
+    Token *tok = tokenize_one(buf, lhs);
+    if (!tok)
+        error_tok(lhs, "連結した結果 \"%s\" はトークンになりません", buf);
+    *lhs = *tok;
+    free_token(tok);
+    free(buf);
+}
+
+// マクロの置換リストの仮引数を実引数で置き換え、#, ## を処理したリストを返す
+static Token *subst(Macro *m, Token **args) {
+    Token *expanded[m->nparams + 1];
+    for (int i = 0; i < m->nparams; i++)
+        expanded[i] = NULL;
+
+    Token head = {};
+    Token *cur = &head;
+
+    for (Token *tok = m->body; tok; tok = tok->next) {
+        // # 仮引数
+        if (!m->is_objlike && tok->id == '#' && param_index(tok->next) >= 0) {
+            cur = cur->next = stringize(tok, args[param_index(tok->next)]);
+            tok = tok->next;
+            continue;
+        }
+
+        // ## の右辺。仮引数であれば展開しない実引数を連結する
+        if (tok->id == PU_HASHHASH) {
+            if (cur == &head)
+                error_tok(tok, "'##' はマクロの先頭には置けません");
+            Token *rhs = tok->next;
+            if (!rhs)
+                error_tok(tok, "'##' はマクロの末尾には置けません");
+
+            int i = param_index(rhs);
+            if (i < 0) {
+                paste(cur, rhs);
+            } else if (args[i]) {
+                paste(cur, args[i]);
+                cur->next = copy_list(args[i]->next);
+                while (cur->next)
+                    cur = cur->next;
+            }
+            tok = rhs;
+            continue;
+        }
+
+        int i = param_index(tok);
+        if (i < 0) {
+            cur = cur->next = copy_token(tok);
+            continue;
+        }
+
+        // ## の左辺の実引数は展開しない
+        if (tok->next && tok->next->id == PU_HASHHASH) {
+            if (args[i]) {
+                cur->next = copy_list(args[i]);
+                while (cur->next)
+                    cur = cur->next;
+                continue;
+            }
+
+            // 空の実引数と ## で連結すると、もう一方がそのまま残る
+            Token *rhs = tok->next->next;
+            int j = param_index(rhs);
+            if (j >= 0) {
+                cur->next = copy_list(args[j]);
+                while (cur->next)
+                    cur = cur->next;
+                tok = rhs;
+            } else {
+                tok = tok->next;
+            }
+            continue;
+        }
+
+        // それ以外の実引数は完全にマクロ展開してから置き換える
+        if (!expanded[i])
+            expanded[i] = expand_arg(args[i]);
+        if (!expanded[i])
+            continue;
+        cur->next = copy_list(expanded[i]);
+        cur->next->has_space = tok->has_space;
+        while (cur->next)
+            cur = cur->next;
+    }
+
+    for (int i = 0; i < m->nparams; i++)
+        free_list(expanded[i]);
+    cur->next = NULL;
+    return head.next;
+}
+
+// 関数形式のマクロの実引数を読む。`name` はマクロ名のトークン。
+static Token **read_macro_args(Macro *m, Token *name) {
+    Token **args = calloc(m->nparams ? m->nparams : 1, sizeof(Token *));
+    int nargs = 0;
+    int depth = 0;
+    Token head = {};
+    Token *cur = &head;
+
+    for (;;) {
+        Token *tok = read_unexpanded();
+        if (!tok || tok->kind == TK_EOF)
+            error_tok(name, "マクロの呼び出しが閉じていません");
+
+        bool is_last = m->is_variadic && nargs == m->nparams - 1;
+        if (depth == 0 && (tok->id == ')' || (tok->id == ',' && !is_last))) {
+            if (nargs < m->nparams)
+                args[nargs] = head.next;
+            else if (head.next || nargs > 0 || tok->id == ',')
+                error_tok(name, "実引数が多すぎます");
+            nargs++;
+            head.next = NULL;
+            cur = &head;
+
+            bool done = tok->id == ')';
+            free_token(tok);
+            if (done)
+                break;
+            continue;
+        }
+
+        if (tok->id == '(')
+            depth++;
+        else if (tok->id == ')')
+            depth--;
+        tok->at_bol = false;
+        cur = cur->next = tok;
+    }
+
+    // 可変長引数は省略してよい
+    if (m->is_variadic && nargs == m->nparams - 1)
+        nargs++;
+    if (nargs < m->nparams)
+        error_tok(name, "実引数が少なすぎます");
+    return args;
+}
+
+// マクロ名のトークン `tok` を展開し、結果をコンテキストに積む。
+// 関数形式のマクロの後に "(" がなければ展開せずに偽を返す。
+static bool expand_macro(Macro *m, Token *tok) {
+    if (m->is_objlike) {
+        Token *body = subst(m, NULL);
+        if (body)
+            body->has_space = tok->has_space;
+        push_context(body, m);
+        free_token(tok);
+        return true;
+    }
+
+    Token *next = read_unexpanded();
+    if (!next)
+        return false;
+    if (next->id != '(') {
+        unget(next);
+        return false;
+    }
+    free_token(next);
+
+    Token **args = read_macro_args(m, tok);
+    Token *body = subst(m, args);
+    if (body)
+        body->has_space = tok->has_space;
+    for (int i = 0; i < m->nparams; i++)
+        free_list(args[i]);
+    free(args);
+
+    push_context(body, m);
+    free_token(tok);
+    return true;
+}
+
+// トークンを１つ、マクロ展開して読む
+static Token *read_expanded(void) {
+    for (;;) {
+        Token *tok = read_unexpanded();
+        if (!tok || tok->no_expand)
+            return tok;
+
+        Macro *m = find_macro(tok);
+        if (!m)
+            return tok;
+
+        // 展開中のマクロの名前は、以後ずっと展開しない
+        if (m->disabled) {
+            tok->no_expand = true;
+            return tok;
+        }
+
+        if (!expand_macro(m, tok))
+            return tok;
+    }
+}
+
+// 実引数を完全にマクロ展開したリストを返す。`arg` はそのまま残る。
+static Token *expand_arg(Token *arg) {
+    Context *contexts0 = contexts;
+    bool in_arg0 = in_arg;
+    contexts = NULL;
+    in_arg = true;
+    push_context(copy_list(arg), NULL);
+
+    Token head = {};
+    Token *cur = &head;
+    for (Token *tok; (tok = read_expanded());)
+        cur = cur->next = tok;
+    cur->next = NULL;
+
+    contexts = contexts0;
+    in_arg = in_arg0;
+    return head.next;
+}
+
+//
+// #include
+//
+
+static bool file_exists(char *path) {
+    struct stat st;
+    return !stat(path, &st);
+}
+
+// `dir` の下に `filename` があれば、そのパスを返す。パスはファイル名として
+// ずっと使うので perm_arena に置く
+static char *find_in_dir(char *dir, char *filename) {
+    char *path = dir ? format("%s/%s", dir, filename) : strdup(filename);
+    char *found = NULL;
+    if (file_exists(path))
+        found = arena_strndup(&perm_arena, path, strlen(path));
+    free(path);
+    return found;
+}
+
+static char *search_include_paths(char *filename, bool quoted, Token *tok) {
+    if (filename[0] == '/')
+        return find_in_dir(NULL, filename);
+
+    // "..." はまずインクルードしたファイルと同じディレクトリから探す
+    if (quoted) {
+        char *name = strdup(tok->file->name);
+        char *path = find_in_dir(dirname(name), filename);
+        free(name);
+        if (path)
+            return path;
+    }
+
+    for (int i = 0; i < include_paths_cnt; i++) {
+        char *path = find_in_dir(include_paths[i], filename);
+        if (path)
+            return path;
+    }
+
+    static char *std_paths[] = {"/usr/local/include", "/usr/include"};
+    for (int i = 0; i < sizeof(std_paths) / sizeof(*std_paths); i++) {
+        char *path = find_in_dir(std_paths[i], filename);
+        if (path)
+            return path;
+    }
+    return NULL;
+}
+
+// ヘッダ全体が #ifndef X ... #endif で囲まれていれば、X を返す
+static char *detect_include_guard(Token *tok) {
+    if (!is_hash(tok) || !equal(tok->next, "ifndef") || tok->next->next->kind != TK_IDENT)
+        return NULL;
+    char *guard = tok->next->next->str;
+
+    int depth = 0;
+    for (; tok->kind != TK_EOF; tok = tok->next) {
+        if (!is_hash(tok))
+            continue;
+
+        Token *name = tok->next;
+        if (equal(name, "if") || equal(name, "ifdef") || equal(name, "ifndef")) {
+            depth++;
+        } else if (depth == 1 && (equal(name, "elif") || equal(name, "else"))) {
+            return NULL;
+        } else if (equal(name, "endif") && --depth == 0) {
+            // #endif の後には何もあってはならない
+            return name->next->kind == TK_EOF ? guard : NULL;
+        }
+    }
+    return NULL;
+}
+
+static void include_file(char *path, Token *tok) {
+    Header *hdr = hashmap_get(&headers, path);
+    if (!hdr) {
+        Token *tokens = tokenize_file(path);
+        if (!tokens)
+            error_tok(tok, "%s: %s", path, strerror(errno));
+        hdr = arena_alloc(&perm_arena, sizeof(Header));
+        hdr->tokens = tokens;
+        hdr->guard = detect_include_guard(tokens);
+        hashmap_put(&headers, path, hdr);
+    } else if (hdr->once) {
+        return;
+    } else if (hdr->guard && hashmap_get(&macros, hdr->guard)) {
+        // インクルードガードのマクロが定義済みなら、読んでも何も残らない
+        return;
+    }
+
+    Source *src = calloc(1, sizeof(Source));
+    src->next = sources;
+    src->hdr = hdr;
+    src->tok = hdr->tokens;
+    src->cond = cond_incl;
+    sources = src;
+}
+
+static void read_include(Token *hash) {
+    Token *line = read_line();
+    if (!line)
+        error_tok(hash, "ファイル名が必要です");
+
+    char *filename;
+    bool quoted;
+    if (line->kind == TK_STR) {
+        filename = strndup(line->loc + 1, line->len - 2);
+        quoted = true;
+    } else if (line->id == '<') {
+        // <...> の中のトークンをつづりのまま連結する
+        Token *tok = line->next;
+        int len = 0;
+        for (Token *t = tok; t && t->id != '>'; t = t->next)
+            len += t->len + 1;
+        filename = calloc(1, len + 1);
+        for (; tok && tok->id != '>'; tok = tok->next) {
+            if (tok != line->next && tok->has_space)
+                strcat(filename, " ");
+            strncat(filename, tok->loc, tok->len);
+        }
+        if (!tok)
+            error_tok(line, "'>' が必要です");
+        quoted = false;
+    } else {
+        error_tok(line, "ファイル名が必要です");
+    }
+
+    char *path = search_include_paths(filename, quoted, line);
+    if (!path)
+        error_tok(line, "%s: ファイルが見つかりません", filename);
+    include_file(path, line);
+    free(filename);
+    free_list(line);
+}
+
+//
+// ディレクティブ
+//
+
+static void directive(Token *hash) {
+    Token *tok = file_token();
+
+    // # だけの行は何もしない
+    if (tok->at_bol || tok->kind == TK_EOF) {
+        unget_file_token(tok);
+        free_token(hash);
+        return;
+    }
+
+    if (equal(tok, "include")) {
+        read_include(tok);
+    } else if (equal(tok, "define")) {
+        read_macro_definition(tok);
+    } else if (equal(tok, "undef")) {
+        Token *line = read_line();
+        if (!line || (line->kind != TK_IDENT && line->kind != TK_KEYWORD))
+            error_tok(tok, "マクロ名が必要です");
+        hashmap_put2(&macros, line->loc, line->len, NULL);
+        free_list(line);
+    } else if (equal(tok, "if")) {
+        bool val = read_const_expr(tok);
+        push_cond_incl(tok, val);
+        if (!val)
+            skip_cond_incl();
+    } else if (equal(tok, "ifdef") || equal(tok, "ifndef")) {
+        Token *line = read_line();
+        if (!line || (line->kind != TK_IDENT && line->kind != TK_KEYWORD))
+            error_tok(tok, "マクロ名が必要です");
+        bool defined = hashmap_get2(&macros, line->loc, line->len);
+        bool val = equal(tok, "ifdef") ? defined : !defined;
+        free_list(line);
+        push_cond_incl(tok, val);
+        if (!val)
+            skip_cond_incl();
+    } else if (equal(tok, "elif")) {
+        if (!cond_incl || cond_incl->ctx == IN_ELSE)
+            error_tok(tok, "対応する #if がありません");
+        cond_incl->ctx = IN_ELIF;
+        if (!cond_incl->included && read_const_expr(tok)) {
+            cond_incl->included = true;
+        } else {
+            free_list(read_line());
+            skip_cond_incl();
+        }
+    } else if (equal(tok, "else")) {
+        if (!cond_incl || cond_incl->ctx == IN_ELSE)
+            error_tok(tok, "対応する #if がありません");
+        cond_incl->ctx = IN_ELSE;
+        free_list(read_line());
+        if (cond_incl->included)
+            skip_cond_incl();
+    } else if (equal(tok, "endif")) {
+        if (!cond_incl || cond_incl == sources->cond)
+            error_tok(tok, "対応する #if がありません");
+        CondIncl *ci = cond_incl;
+        cond_incl = ci->next;
+        free_token(ci->tok);
+        free(ci);
+        free_list(read_line());
+    } else if (equal(tok, "pragma")) {
+        Token *line = read_line();
+        if (line && equal(line, "once") && sources->hdr)
+            sources->hdr->once = true;
+        free_list(line);
+    } else if (equal(tok, "error")) {
+        Token *line = read_line();
+        if (!line)
+            error_tok(tok, "#error");
+        error_tok(tok, "#error %s", join_tokens(line));
+    } else {
+        error_tok(tok, "不正なディレクティブです");
+    }
+
+    // #if などのトークンは条件付きの範囲が参照するので解放しない
+    if (!cond_incl || cond_incl->tok != tok)
+        free_token(tok);
+    free_token(hash);
+}
+
+// トップレベルの宣言１つ分のトークンを読み、TK_EOF のトークンで終端した
+// リストとして返す。入力の終わりでは TK_EOF のトークンだけを返す。
+//
+// パーサの先読みはトップレベルの宣言をまたがないので、入力全体を一度に
+// トークナイズしておく必要はない。パースの済んだ宣言のトークンは
+// release_tokens で解放できるので、入力がどれだけ大きくても、同時に
+// 保持するトークンは宣言１つ分で済む。
+//
+// 宣言の終わりは、括弧の外にある ";" か、関数本体を閉じる "}" である。
+// ここでは、")" の直後の "{" を関数本体の始まりとみなしている。
+Token *read_toplevel(void) {
+    if (!va_args_atom)
+        va_args_atom = intern("__VA_ARGS__", 11);
+
+    Token head = {};
+    Token *cur = &head;
+    int depth = 0;
+    bool in_body = false;
+
+    for (;;) {
+        Token *tok = read_expanded();
+
+        if (tok->kind == TK_EOF) {
+            if (cond_incl)
+                error_tok(cond_incl->tok, "#endif がありません");
+            cur->next = tok;
+            return head.next;
+        }
+
+        bool at_body = tok->id == '{' && depth == 0 && cur != &head && cur->id == ')';
+        cur = cur->next = tok;
+
+        if (tok->id == '{') {
+            in_body |= at_body;
+            depth++;
+        } else if (tok->id == '}') {
+            if (--depth == 0 && in_body)
+                break;
+        } else if (tok->id == ';' && depth == 0) {
+            break;
+        }
+    }
+
+    // 宣言の終わりを表す TK_EOF は、最後のトークンの直後を指すようにする
+    cur->next = new_eof(cur);
+    return head.next;
+}
+
+//
+// 増分パースのための情報
+//
+// 増分パースでは、入力ファイルの途中からトークナイズし直して read_toplevel で
+// 読む。そのためには、宣言の区切りが入力ファイルのどの位置にあるかと、
+// その位置から読み直してよいかどうかが分かる必要がある。
+//
+
+// 入力ファイルをどこまで読んだかを返す。ディレクティブの後などで読み戻した
+// トークンがあれば、その位置までしか読んでいないものとする
+char *read_position(void) {
+    return main_source.ahead ? main_source.ahead->loc : token_stream_pos();
+}
+
+// 入力ファイルで最後に処理したディレクティブの次の行の位置を返す。
+// ディレクティブがなければ NULL を返す。これより前から読み直すと、
+// ディレクティブを処理し直すことになる。
+char *last_directive_end(void) {
+    return directives_end;
+}
+
+// マクロ展開の結果がまだ読み終わっていなければ真を返す。このときの位置は
+// 宣言の区切りであっても、そこから読み直すことはできない
+bool expansion_pending(void) {
+    for (Context *ctx = contexts; ctx; ctx = ctx->next)
+        if (ctx->tok)
+            return true;
+    return false;
+}
+
+// 入力ファイルの内容が [old, old_end) から `buf` に移ったので、マクロの名前と
+// 置換リストのうち、元の内容を指しているものの位置を付け替える
+void move_macros(char *old, char *old_end, char *buf) {
+    for (int i = 0; i < macros.capacity; i++) {
+        HashEntry *ent = &macros.buckets[i];
+        if (!ent->key)
+            continue;
+        if (old <= ent->key && ent->key < old_end)
+            ent->key = buf + (ent->key - old);
+
+        Macro *m = ent->val;
+        if (!m)
+            continue;
+        for (Token *tok = m->body; tok; tok = tok->next)
+            if (old <= tok->loc && tok->loc < old_end)
+                tok->loc = buf + (tok->loc - old);
+    }
+    if (old <= directives_end && directives_end < old_end)
+        directives_end = buf + (directives_end - old);
+}
+
+// 入力ファイルの `loc` にある "{" から対応する "}" までを読み直し、TK_EOF で
+// 終端したリストとして返す。マクロは現在の定義で展開する。"{" で始まって
+// いない場合や、途中でディレクティブか入力の終わりに出会った場合は NULL を
+// 返す。読み終えたら、読み直す前の位置に戻る。
+Token *reread_block(char *loc) {
+    Source *src = sources;
+    Token *ahead = main_source.ahead;
+    Context *ctx = contexts;
+    char *pos = token_stream_pos();
+
+    sources = &main_source;
+    main_source.ahead = NULL;
+    contexts = NULL;
+    seek_token_stream(loc);
+    rereading = true;
+    reread_failed = false;
+
+    Token head = {};
+    Token *cur = &head;
+    for (int depth = 0;;) {
+        Token *tok = read_expanded();
+        cur = cur->next = tok;
+        if (reread_failed || tok->kind == TK_EOF || (depth == 0 && tok->id != '{')) {
+            reread_failed = true;
+            break;
+        }
+        if (tok->id == '{')
+            depth++;
+        else if (tok->id == '}' && --depth == 0)
+            break;
+    }
+    rereading = false;
+
+    // "}" の後に残ったマクロ展開の結果と読み戻したトークンは捨てる
+    while (contexts) {
+        Context *c = contexts;
+        for (Token *tok = c->tok, *next; tok; tok = next) {
+            next = tok->next;
+            free_token(tok);
+        }
+        if (c->macro)
+            c->macro->disabled = false;
+        contexts = c->next;
+        free(c);
+    }
+    for (Token *tok = main_source.ahead, *next; tok; tok = next) {
+        next = tok->next;
+        free_token(tok);
+    }
+
+    sources = src;
+    main_source.ahead = ahead;
+    contexts = ctx;
+    seek_token_stream(pos);
+
+    if (cur->kind != TK_EOF)
+        cur = cur->next = new_eof(cur);
+    if (reread_failed) {
+        release_tokens(head.next);
+        return NULL;
+    }
+    return head.next;
+}
+
+// プリプロセッサの状態を初期状態に戻す（reset_compiler を参照）。マクロ、
+// ヘッダのキャッシュ、読みかけのファイルや条件付きの範囲を捨てる。
+// インクルードパスは設定なので残す
+void reset_preprocessor(void) {
+    while (contexts) {
+        Context *ctx = contexts;
+        contexts = ctx->next;
+        free(ctx);
+    }
+    while (cond_incl) {
+        CondIncl *ci = cond_incl;
+        cond_incl = ci->next;
+        free(ci);
+    }
+    while (sources != &main_source) {
+        Source *src = sources;
+        sources = src->next;
+        free(src);
+    }
+    main_source = (Source){};
+
+    free(macros.buckets);
+    free(headers.buckets);
+    macros = (HashMap){};
+    headers = (HashMap){};
+    in_arg = false;
+    va_args_atom = NULL;
+    directives_end = NULL;
+    rereading = reread_failed = false;
+}
@@ -12,4 +12,37 @@ char *format(char *fmt, ...) {
     va_end(ap);
     fclose(out);
     return buf;
+}
+
+// インターンした文字列は、その名前の束縛の直後に置く
+typedef struct {
+    Binding binding;
+    char name[];
+} Atom;
+
+// インターンした文字列の表。文字列は perm_arena に置く
+static HashMap atoms;
+
+// 同じ内容の文字列に対しては常に同じポインタを返す。
+// 識別子をインターンしておけば、名前の比較はポインタの比較で済む。
+char *intern(char *s, int len) {
+    char *name = hashmap_get2(&atoms, s, len);
+    if (name)
+        return name;
+
+    Atom *atom = arena_alloc(&perm_arena, sizeof(Atom) + len + 1);
+    memcpy(atom->name, s, len);
+    hashmap_put2(&atoms, atom->name, len, atom->name);
+    return atom->name;
+}
+
+// インターンした文字列の束縛を返す
+Binding *get_binding(char *atom) {
+    return (Binding *)(atom - offsetof(Atom, name));
+}
+
+// インターンした文字列をすべて忘れる。文字列は perm_arena とともに解放される
+void reset_strings(void) {
+    free(atoms.buckets);
+    atoms = (HashMap){};
 }
\ No newline at end of file
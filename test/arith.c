@@ -33,6 +33,19 @@ int main() {
     ASSERT(1, 1>=1);
     ASSERT(0, 1>=2);
 
+    ASSERT(13, 3*4+1);
+    ASSERT(1, 2147483647+1 > 0);
+    ASSERT(1, 9223372036854775807+1 < 0);
+    ASSERT(-3, -7/2);
+    ASSERT(3, -7/-2);
+    ASSERT(5, ({ int x=5; x*1; }));
+    ASSERT(5, ({ int x=5; 1*x+0; }));
+    ASSERT(5, ({ int x=5; 0+x-0; }));
+    ASSERT(0, ({ int x=5; x-x; }));
+    ASSERT(0, ({ int x=5; x*0; }));
+    ASSERT(6, ({ int x=5; (x=6)*0; x; }));
+    ASSERT(5, ({ int x=5; x/1; }));
+
     printf("OK\n");
     return 0;
 }
\ No newline at end of file
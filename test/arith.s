@@ -0,0 +1,1254 @@
+.file 1 "test/arith.c"
+.file 2 "test/test.h"
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $32, %rsp
+  .loc 2 1
+  .loc 2 1
+  .loc 2 1
+  .loc 1 4
+  mov $0, %rax
+  push %rax
+  .loc 1 4
+  mov $0, %rax
+  push %rax
+  .loc 2 1
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 5
+  mov $42, %rax
+  push %rax
+  .loc 1 5
+  mov $42, %rax
+  push %rax
+  .loc 2 1
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 6
+  mov $25, %rax
+  push %rax
+  .loc 1 6
+  mov $25, %rax
+  push %rax
+  .loc 2 1
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 7
+  mov $8, %rax
+  push %rax
+  .loc 1 7
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 8
+  mov $21, %rax
+  push %rax
+  .loc 1 8
+  mov $21, %rax
+  push %rax
+  .loc 2 1
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 9
+  mov $41, %rax
+  push %rax
+  .loc 1 9
+  mov $41, %rax
+  push %rax
+  .loc 2 1
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 10
+  mov $47, %rax
+  push %rax
+  .loc 1 10
+  mov $47, %rax
+  push %rax
+  .loc 2 1
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 11
+  mov $15, %rax
+  push %rax
+  .loc 1 11
+  mov $15, %rax
+  push %rax
+  .loc 2 1
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 12
+  mov $4, %rax
+  push %rax
+  .loc 1 12
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 13
+  mov $10, %rax
+  push %rax
+  .loc 1 13
+  mov $10, %rax
+  push %rax
+  .loc 2 1
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 14
+  mov $10, %rax
+  push %rax
+  .loc 1 14
+  mov $10, %rax
+  push %rax
+  .loc 2 1
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 15
+  mov $10, %rax
+  push %rax
+  .loc 1 15
+  mov $10, %rax
+  push %rax
+  .loc 2 1
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 17
+  mov $0, %rax
+  push %rax
+  .loc 1 17
+  mov $0, %rax
+  push %rax
+  .loc 2 1
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 18
+  mov $1, %rax
+  push %rax
+  .loc 1 18
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 19
+  mov $1, %rax
+  push %rax
+  .loc 1 19
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..14(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 20
+  mov $0, %rax
+  push %rax
+  .loc 1 20
+  mov $0, %rax
+  push %rax
+  .loc 2 1
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 22
+  mov $1, %rax
+  push %rax
+  .loc 1 22
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..16(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 23
+  mov $0, %rax
+  push %rax
+  .loc 1 23
+  mov $0, %rax
+  push %rax
+  .loc 2 1
+  lea .L..17(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 24
+  mov $0, %rax
+  push %rax
+  .loc 1 24
+  mov $0, %rax
+  push %rax
+  .loc 2 1
+  lea .L..18(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 25
+  mov $1, %rax
+  push %rax
+  .loc 1 25
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..19(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 26
+  mov $1, %rax
+  push %rax
+  .loc 1 26
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..20(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 27
+  mov $0, %rax
+  push %rax
+  .loc 1 27
+  mov $0, %rax
+  push %rax
+  .loc 2 1
+  lea .L..21(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 29
+  mov $1, %rax
+  push %rax
+  .loc 1 29
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..22(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 30
+  mov $0, %rax
+  push %rax
+  .loc 1 30
+  mov $0, %rax
+  push %rax
+  .loc 2 1
+  lea .L..23(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 31
+  mov $0, %rax
+  push %rax
+  .loc 1 31
+  mov $0, %rax
+  push %rax
+  .loc 2 1
+  lea .L..24(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 32
+  mov $1, %rax
+  push %rax
+  .loc 1 32
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..25(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 33
+  mov $1, %rax
+  push %rax
+  .loc 1 33
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..26(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 34
+  mov $0, %rax
+  push %rax
+  .loc 1 34
+  mov $0, %rax
+  push %rax
+  .loc 2 1
+  lea .L..27(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 36
+  mov $13, %rax
+  push %rax
+  .loc 1 36
+  mov $13, %rax
+  push %rax
+  .loc 2 1
+  lea .L..28(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 37
+  mov $1, %rax
+  push %rax
+  .loc 1 37
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..29(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 38
+  mov $1, %rax
+  push %rax
+  .loc 1 38
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..30(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 39
+  mov $-3, %rax
+  push %rax
+  .loc 1 39
+  mov $-3, %rax
+  push %rax
+  .loc 2 1
+  lea .L..31(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 40
+  mov $3, %rax
+  push %rax
+  .loc 1 40
+  mov $3, %rax
+  push %rax
+  .loc 2 1
+  lea .L..32(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 41
+  mov $5, %rax
+  push %rax
+  .loc 1 41
+  .loc 1 41
+  .loc 1 41
+  .loc 1 41
+  lea -28(%rbp), %rax
+  push %rax
+  .loc 1 41
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 41
+  .loc 1 41
+  lea -28(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..33(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 42
+  mov $5, %rax
+  push %rax
+  .loc 1 42
+  .loc 1 42
+  .loc 1 42
+  .loc 1 42
+  lea -24(%rbp), %rax
+  push %rax
+  .loc 1 42
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 42
+  .loc 1 42
+  lea -24(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..34(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 43
+  mov $5, %rax
+  push %rax
+  .loc 1 43
+  .loc 1 43
+  .loc 1 43
+  .loc 1 43
+  lea -20(%rbp), %rax
+  push %rax
+  .loc 1 43
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 43
+  .loc 1 43
+  lea -20(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..35(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 44
+  mov $0, %rax
+  push %rax
+  .loc 1 44
+  .loc 1 44
+  .loc 1 44
+  .loc 1 44
+  lea -16(%rbp), %rax
+  push %rax
+  .loc 1 44
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 44
+  .loc 1 44
+  mov $0, %rax
+  push %rax
+  .loc 2 1
+  lea .L..36(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 45
+  mov $0, %rax
+  push %rax
+  .loc 1 45
+  .loc 1 45
+  .loc 1 45
+  .loc 1 45
+  lea -12(%rbp), %rax
+  push %rax
+  .loc 1 45
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 45
+  .loc 1 45
+  mov $0, %rax
+  push %rax
+  .loc 2 1
+  lea .L..37(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 46
+  mov $6, %rax
+  push %rax
+  .loc 1 46
+  .loc 1 46
+  .loc 1 46
+  .loc 1 46
+  lea -8(%rbp), %rax
+  push %rax
+  .loc 1 46
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 46
+  .loc 1 46
+  .loc 1 46
+  mov $0, %rax
+  push %rax
+  .loc 1 46
+  lea -8(%rbp), %rax
+  push %rax
+  .loc 1 46
+  mov $6, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  pop %rdi
+  imul %rdi, %rax
+  .loc 1 46
+  .loc 1 46
+  lea -8(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..38(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 47
+  mov $5, %rax
+  push %rax
+  .loc 1 47
+  .loc 1 47
+  .loc 1 47
+  .loc 1 47
+  lea -4(%rbp), %rax
+  push %rax
+  .loc 1 47
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 47
+  .loc 1 47
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..39(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 49
+  .loc 1 49
+  .loc 1 49
+  lea .L..40(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+  .loc 1 50
+  .loc 1 50
+  mov $0, %rax
+  jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .data
+  .global .L..40
+.L..40:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .data
+  .global .L..39
+.L..39:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..38
+.L..38:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 61
+  .byte 54
+  .byte 41
+  .byte 42
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..37
+.L..37:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..36
+.L..36:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 45
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..35
+.L..35:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 48
+  .byte 43
+  .byte 120
+  .byte 45
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..34
+.L..34:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 49
+  .byte 42
+  .byte 120
+  .byte 43
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..33
+.L..33:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..32
+.L..32:
+  .byte 45
+  .byte 55
+  .byte 47
+  .byte 45
+  .byte 50
+  .byte 0
+  .data
+  .global .L..31
+.L..31:
+  .byte 45
+  .byte 55
+  .byte 47
+  .byte 50
+  .byte 0
+  .data
+  .global .L..30
+.L..30:
+  .byte 57
+  .byte 50
+  .byte 50
+  .byte 51
+  .byte 51
+  .byte 55
+  .byte 50
+  .byte 48
+  .byte 51
+  .byte 54
+  .byte 56
+  .byte 53
+  .byte 52
+  .byte 55
+  .byte 55
+  .byte 53
+  .byte 56
+  .byte 48
+  .byte 55
+  .byte 43
+  .byte 49
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 48
+  .byte 0
+  .data
+  .global .L..29
+.L..29:
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 43
+  .byte 49
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 48
+  .byte 0
+  .data
+  .global .L..28
+.L..28:
+  .byte 51
+  .byte 42
+  .byte 52
+  .byte 43
+  .byte 49
+  .byte 0
+  .data
+  .global .L..27
+.L..27:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 50
+  .byte 0
+  .data
+  .global .L..26
+.L..26:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 49
+  .byte 0
+  .data
+  .global .L..25
+.L..25:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 48
+  .byte 0
+  .data
+  .global .L..24
+.L..24:
+  .byte 49
+  .byte 62
+  .byte 50
+  .byte 0
+  .data
+  .global .L..23
+.L..23:
+  .byte 49
+  .byte 62
+  .byte 49
+  .byte 0
+  .data
+  .global .L..22
+.L..22:
+  .byte 49
+  .byte 62
+  .byte 48
+  .byte 0
+  .data
+  .global .L..21
+.L..21:
+  .byte 50
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+  .data
+  .global .L..20
+.L..20:
+  .byte 49
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+  .data
+  .global .L..19
+.L..19:
+  .byte 48
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+  .data
+  .global .L..18
+.L..18:
+  .byte 50
+  .byte 60
+  .byte 49
+  .byte 0
+  .data
+  .global .L..17
+.L..17:
+  .byte 49
+  .byte 60
+  .byte 49
+  .byte 0
+  .data
+  .global .L..16
+.L..16:
+  .byte 48
+  .byte 60
+  .byte 49
+  .byte 0
+  .data
+  .global .L..15
+.L..15:
+  .byte 52
+  .byte 50
+  .byte 33
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 0
+  .data
+  .global .L..14
+.L..14:
+  .byte 48
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 0
+  .data
+  .global .L..13
+.L..13:
+  .byte 52
+  .byte 50
+  .byte 61
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 0
+  .data
+  .global .L..12
+.L..12:
+  .byte 48
+  .byte 61
+  .byte 61
+  .byte 49
+  .byte 0
+  .data
+  .global .L..11
+.L..11:
+  .byte 45
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 43
+  .byte 49
+  .byte 48
+  .byte 0
+  .data
+  .global .L..10
+.L..10:
+  .byte 45
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 0
+  .data
+  .global .L..9
+.L..9:
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 43
+  .byte 50
+  .byte 48
+  .byte 0
+  .data
+  .global .L..8
+.L..8:
+  .byte 40
+  .byte 51
+  .byte 43
+  .byte 53
+  .byte 41
+  .byte 47
+  .byte 50
+  .byte 0
+  .data
+  .global .L..7
+.L..7:
+  .byte 53
+  .byte 42
+  .byte 40
+  .byte 57
+  .byte 45
+  .byte 54
+  .byte 41
+  .byte 0
+  .data
+  .global .L..6
+.L..6:
+  .byte 53
+  .byte 43
+  .byte 54
+  .byte 42
+  .byte 55
+  .byte 0
+  .data
+  .global .L..5
+.L..5:
+  .byte 49
+  .byte 50
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 51
+  .byte 52
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 53
+  .byte 0
+  .data
+  .global .L..4
+.L..4:
+  .byte 53
+  .byte 43
+  .byte 50
+  .byte 48
+  .byte 45
+  .byte 52
+  .byte 0
+  .data
+  .global .L..3
+.L..3:
+  .byte 49
+  .byte 54
+  .byte 45
+  .byte 56
+  .byte 0
+  .data
+  .global .L..2
+.L..2:
+  .byte 53
+  .byte 43
+  .byte 50
+  .byte 48
+  .byte 0
+  .data
+  .global .L..1
+.L..1:
+  .byte 52
+  .byte 50
+  .byte 0
+  .data
+  .global .L..0
+.L..0:
+  .byte 48
+  .byte 0
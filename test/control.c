@@ -4,6 +4,14 @@
  * This is a block comment.
  */
 
+int count_to(int n) {
+    int i=0;
+    while (1) {
+        i=i+1;
+        if (i==n) return i;
+    }
+}
+
 int main() {
     ASSERT(3, ({ int x; if (0) x=2; else x=3; x; }));
     ASSERT(3, ({ int x; if (1-1) x=2; else x=3; x; }));
@@ -20,6 +28,11 @@ int main() {
     ASSERT(10, ({ int i=0; while(i<10) i=i+1; i; }));
     ASSERT(55, ({ int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j; }));
 
+    ASSERT(3, ({ int x=3; if (0) x=2; x; }));
+    ASSERT(2, ({ int x=3; if (2*3-6) x=1; else { x=2; } x; }));
+    ASSERT(5, ({ int i=0; for (i=5; 0; i=i+1) i=9; i; }));
+    ASSERT(10, count_to(10));
+
     ASSERT(3, (1,2,3));
     // ASSERT(5, ({ int i=2, j=3; (i=5,j)=6; i; }));
     // ASSERT(6, ({ int i=2, j=3; (i=5,j)=6; j; }));
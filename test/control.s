@@ -0,0 +1,1244 @@
+.file 1 "test/control.c"
+.file 2 "test/test.h"
+  .globl count_to
+  .text
+count_to:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+  mov %edi, -8(%rbp)
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  lea -4(%rbp), %rax
+  push %rax
+  .loc 1 8
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 9
+.L.begin.1:
+  .loc 1 10
+  .loc 1 10
+  .loc 1 10
+  lea -4(%rbp), %rax
+  push %rax
+  .loc 1 10
+  .loc 1 10
+  mov $1, %rax
+  push %rax
+  .loc 1 10
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  lea -8(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 11
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  cmp %rdi, %rax
+  sete %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je .L.else.2
+  .loc 1 11
+  .loc 1 11
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  jmp .L.return.count_to
+  jmp .L.end.2
+.L.else.2:
+.L.end.2:
+  jmp .L.begin.1
+.L.end.1:
+.L.return.count_to:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $64, %rsp
+  .loc 2 1
+  .loc 2 1
+  .loc 2 1
+  .loc 1 16
+  mov $3, %rax
+  push %rax
+  .loc 1 16
+  .loc 1 16
+  .loc 1 16
+  lea -52(%rbp), %rax
+  push %rax
+  .loc 1 16
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 16
+  .loc 1 16
+  lea -52(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 17
+  mov $3, %rax
+  push %rax
+  .loc 1 17
+  .loc 1 17
+  .loc 1 17
+  lea -48(%rbp), %rax
+  push %rax
+  .loc 1 17
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 17
+  .loc 1 17
+  lea -48(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 18
+  mov $2, %rax
+  push %rax
+  .loc 1 18
+  .loc 1 18
+  .loc 1 18
+  lea -44(%rbp), %rax
+  push %rax
+  .loc 1 18
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 18
+  .loc 1 18
+  lea -44(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 19
+  mov $2, %rax
+  push %rax
+  .loc 1 19
+  .loc 1 19
+  .loc 1 19
+  lea -40(%rbp), %rax
+  push %rax
+  .loc 1 19
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 19
+  .loc 1 19
+  lea -40(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 21
+  mov $55, %rax
+  push %rax
+  .loc 1 21
+  .loc 1 21
+  .loc 1 21
+  .loc 1 21
+  lea -36(%rbp), %rax
+  push %rax
+  .loc 1 21
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 21
+  .loc 1 21
+  .loc 1 21
+  lea -32(%rbp), %rax
+  push %rax
+  .loc 1 21
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 21
+  .loc 1 21
+  .loc 1 21
+  lea -36(%rbp), %rax
+  push %rax
+  .loc 1 21
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+.L.begin.3:
+  .loc 1 21
+  .loc 1 21
+  mov $10, %rax
+  push %rax
+  .loc 1 21
+  lea -36(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  cmp %rdi, %rax
+  setle %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je .L.end.3
+  .loc 1 21
+  .loc 1 21
+  lea -32(%rbp), %rax
+  push %rax
+  .loc 1 21
+  .loc 1 21
+  lea -32(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 21
+  lea -36(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 21
+  lea -36(%rbp), %rax
+  push %rax
+  .loc 1 21
+  .loc 1 21
+  mov $1, %rax
+  push %rax
+  .loc 1 21
+  lea -36(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  jmp .L.begin.3
+.L.end.3:
+  .loc 1 21
+  .loc 1 21
+  lea -32(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 23
+  mov $10, %rax
+  push %rax
+  .loc 1 23
+  .loc 1 23
+  .loc 1 23
+  .loc 1 23
+  lea -28(%rbp), %rax
+  push %rax
+  .loc 1 23
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 23
+.L.begin.4:
+  .loc 1 23
+  .loc 1 23
+  mov $10, %rax
+  push %rax
+  .loc 1 23
+  lea -28(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  cmp %rdi, %rax
+  setl %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je .L.end.4
+  .loc 1 23
+  .loc 1 23
+  lea -28(%rbp), %rax
+  push %rax
+  .loc 1 23
+  .loc 1 23
+  mov $1, %rax
+  push %rax
+  .loc 1 23
+  lea -28(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  jmp .L.begin.4
+.L.end.4:
+  .loc 1 23
+  .loc 1 23
+  lea -28(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 25
+  mov $3, %rax
+  push %rax
+  .loc 1 25
+  .loc 1 25
+  .loc 1 25
+  mov $1, %rax
+  .loc 1 25
+  .loc 1 25
+  .loc 1 25
+  mov $2, %rax
+  .loc 1 25
+  .loc 1 25
+  mov $3, %rax
+  push %rax
+  .loc 2 1
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 26
+  mov $5, %rax
+  push %rax
+  .loc 1 26
+  .loc 1 26
+  .loc 1 26
+  mov $5, %rax
+  push %rax
+  .loc 2 1
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 28
+  mov $10, %rax
+  push %rax
+  .loc 1 28
+  .loc 1 28
+  .loc 1 28
+  .loc 1 28
+  lea -24(%rbp), %rax
+  push %rax
+  .loc 1 28
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 28
+.L.begin.5:
+  .loc 1 28
+  .loc 1 28
+  mov $10, %rax
+  push %rax
+  .loc 1 28
+  lea -24(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  cmp %rdi, %rax
+  setl %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je .L.end.5
+  .loc 1 28
+  .loc 1 28
+  lea -24(%rbp), %rax
+  push %rax
+  .loc 1 28
+  .loc 1 28
+  mov $1, %rax
+  push %rax
+  .loc 1 28
+  lea -24(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  jmp .L.begin.5
+.L.end.5:
+  .loc 1 28
+  .loc 1 28
+  lea -24(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 29
+  mov $55, %rax
+  push %rax
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  lea -20(%rbp), %rax
+  push %rax
+  .loc 1 29
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  lea -16(%rbp), %rax
+  push %rax
+  .loc 1 29
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 29
+.L.begin.6:
+  .loc 1 29
+  .loc 1 29
+  mov $10, %rax
+  push %rax
+  .loc 1 29
+  lea -20(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  cmp %rdi, %rax
+  setle %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je .L.end.6
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  lea -16(%rbp), %rax
+  push %rax
+  .loc 1 29
+  .loc 1 29
+  lea -16(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 29
+  lea -20(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 29
+  .loc 1 29
+  lea -20(%rbp), %rax
+  push %rax
+  .loc 1 29
+  .loc 1 29
+  mov $1, %rax
+  push %rax
+  .loc 1 29
+  lea -20(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  jmp .L.begin.6
+.L.end.6:
+  .loc 1 29
+  .loc 1 29
+  lea -16(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 31
+  mov $3, %rax
+  push %rax
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  lea -12(%rbp), %rax
+  push %rax
+  .loc 1 31
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 31
+  .loc 1 31
+  lea -12(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 32
+  mov $2, %rax
+  push %rax
+  .loc 1 32
+  .loc 1 32
+  .loc 1 32
+  .loc 1 32
+  lea -8(%rbp), %rax
+  push %rax
+  .loc 1 32
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 32
+  .loc 1 32
+  .loc 1 32
+  lea -8(%rbp), %rax
+  push %rax
+  .loc 1 32
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 32
+  .loc 1 32
+  lea -8(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 33
+  mov $5, %rax
+  push %rax
+  .loc 1 33
+  .loc 1 33
+  .loc 1 33
+  .loc 1 33
+  lea -4(%rbp), %rax
+  push %rax
+  .loc 1 33
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 33
+  .loc 1 33
+  lea -4(%rbp), %rax
+  push %rax
+  .loc 1 33
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 33
+  .loc 1 33
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 34
+  mov $10, %rax
+  push %rax
+  .loc 1 34
+  .loc 1 34
+  mov $10, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call count_to
+  push %rax
+  .loc 2 1
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 36
+  mov $3, %rax
+  push %rax
+  .loc 1 36
+  mov $3, %rax
+  push %rax
+  .loc 2 1
+  lea .L..14(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 40
+  .loc 1 40
+  .loc 1 40
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+  .loc 1 41
+  .loc 1 41
+  mov $0, %rax
+  jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .data
+  .global .L..15
+.L..15:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .data
+  .global .L..14
+.L..14:
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .byte 0
+  .data
+  .global .L..13
+.L..13:
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+  .data
+  .global .L..12
+.L..12:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..11
+.L..11:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 50
+  .byte 42
+  .byte 51
+  .byte 45
+  .byte 54
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..10
+.L..10:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..9
+.L..9:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 106
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..8
+.L..8:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..7
+.L..7:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 59
+  .byte 59
+  .byte 59
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..6
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 50
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..5
+.L..5:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..4
+.L..4:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..3
+.L..3:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..2
+.L..2:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..1
+.L..1:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..0
+.L..0:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
@@ -0,0 +1,985 @@
+.file 1 "test/decl.c"
+.file 2 "test/test.h"
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $144, %rsp
+  .loc 2 1
+  .loc 2 1
+  .loc 2 1
+  .loc 1 4
+  mov $1, %rax
+  push %rax
+  .loc 1 4
+  .loc 1 4
+  .loc 1 4
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 5
+  mov $2, %rax
+  push %rax
+  .loc 1 5
+  .loc 1 5
+  .loc 1 5
+  mov $2, %rax
+  push %rax
+  .loc 2 1
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 6
+  mov $2, %rax
+  push %rax
+  .loc 1 6
+  .loc 1 6
+  .loc 1 6
+  mov $2, %rax
+  push %rax
+  .loc 2 1
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 7
+  mov $4, %rax
+  push %rax
+  .loc 1 7
+  .loc 1 7
+  .loc 1 7
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 8
+  mov $8, %rax
+  push %rax
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 9
+  mov $8, %rax
+  push %rax
+  .loc 1 9
+  .loc 1 9
+  .loc 1 9
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 11
+  mov $8, %rax
+  push %rax
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 13
+  mov $24, %rax
+  push %rax
+  .loc 1 13
+  .loc 1 13
+  .loc 1 13
+  mov $24, %rax
+  push %rax
+  .loc 2 1
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 14
+  mov $8, %rax
+  push %rax
+  .loc 1 14
+  .loc 1 14
+  .loc 1 14
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 15
+  mov $1, %rax
+  push %rax
+  .loc 1 15
+  .loc 1 15
+  .loc 1 15
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 16
+  mov $3, %rax
+  push %rax
+  .loc 1 16
+  .loc 1 16
+  .loc 1 16
+  mov $3, %rax
+  push %rax
+  .loc 2 1
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 17
+  mov $12, %rax
+  push %rax
+  .loc 1 17
+  .loc 1 17
+  .loc 1 17
+  mov $12, %rax
+  push %rax
+  .loc 2 1
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 18
+  mov $4, %rax
+  push %rax
+  .loc 1 18
+  .loc 1 18
+  .loc 1 18
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 19
+  mov $3, %rax
+  push %rax
+  .loc 1 19
+  .loc 1 19
+  .loc 1 19
+  .loc 1 19
+  lea -40(%rbp), %rax
+  push %rax
+  .loc 1 19
+  lea -12(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 19
+  .loc 1 19
+  lea -12(%rbp), %rax
+  push %rax
+  .loc 1 19
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 19
+  .loc 1 19
+  .loc 1 19
+  .loc 1 19
+  lea -40(%rbp), %rax
+  mov (%rax), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 20
+  mov $4, %rax
+  push %rax
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  lea -8(%rbp), %rax
+  push %rax
+  .loc 1 20
+  lea -11(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  lea -8(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  .loc 1 20
+  mov $4, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  lea -8(%rbp), %rax
+  mov (%rax), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..14(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 21
+  mov $8, %rax
+  push %rax
+  .loc 1 21
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 22
+  mov $12, %rax
+  push %rax
+  .loc 1 22
+  mov $12, %rax
+  push %rax
+  .loc 2 1
+  lea .L..16(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 23
+  mov $24, %rax
+  push %rax
+  .loc 1 23
+  mov $24, %rax
+  push %rax
+  .loc 2 1
+  lea .L..17(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 25
+  .loc 1 25
+  .loc 1 25
+  lea .L..18(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+  .loc 1 26
+  .loc 1 26
+  mov $0, %rax
+  jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .data
+  .global .L..18
+.L..18:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .data
+  .global .L..17
+.L..17:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 41
+  .byte 0
+  .data
+  .global .L..16
+.L..16:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 0
+  .data
+  .global .L..15
+.L..15:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 0
+  .data
+  .global .L..14
+.L..14:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 121
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..13
+.L..13:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..12
+.L..12:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..11
+.L..11:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..10
+.L..10:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..9
+.L..9:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..8
+.L..8:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..7
+.L..7:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..6
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..5
+.L..5:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..4
+.L..4:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..3
+.L..3:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..2
+.L..2:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..1
+.L..1:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..0
+.L..0:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
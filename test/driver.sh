@@ -18,8 +18,213 @@ rm -f $tmp/out
 [ -f $tmp/out ]
 check -o
 
+# コンパイルに失敗したときは出力先ファイルを残さない
+echo 'int f(){return 1;} int main(){return f()+;}' > $tmp/syntax.c
+./chibicc -o $tmp/syntax.s $tmp/syntax.c 2>/dev/null
+[ $? -ne 0 ] && ! ls $tmp/syntax.s* >/dev/null 2>&1
+check 'no output on error'
+
 # --help
 ./chibicc --help 2>&1 | grep -q chibicc
 check --help
 
+# 標準入力と、末尾に改行がなくページの大きさちょうどのファイル
+echo 'int main() { return 0; }' | ./chibicc -o $tmp/stdin.s - &&
+    grep -q '^main:' $tmp/stdin.s
+check 'stdin input'
+{ printf 'int main() { return 0; }'; printf '%4070s//' ''; } > $tmp/page.c
+[ $(wc -c < $tmp/page.c) = 4096 ] && ./chibicc -o $tmp/page.s $tmp/page.c &&
+    grep -q '^main:' $tmp/page.s
+check 'page-sized input'
+
+# -j（make PARALLEL=1 でビルドした場合だけ）
+if ./chibicc --help 2>&1 | grep -q -- '-j <threads>'; then
+    for i in `seq 200`; do
+        echo "/* comment $i"
+        echo "   spanning lines */ int f$i() { return $i; } // $i"
+    done > $tmp/par.c
+    ./chibicc -o $tmp/par1.s $tmp/par.c
+    ./chibicc -j 4 -o $tmp/par4.s $tmp/par.c
+    cmp -s $tmp/par1.s $tmp/par4.s
+    check -j
+fi
+
+# -I
+mkdir -p $tmp/dir
+echo 'int foo;' > $tmp/dir/i-option-test.h
+echo '#include "i-option-test.h"' > $tmp/inc.c
+./chibicc -I$tmp/dir -o $tmp/inc.s $tmp/inc.c
+check -I
+
+# -MD, -MF
+./chibicc -I $tmp/dir -MD -o $tmp/inc.s $tmp/inc.c
+grep -q "$tmp/inc.s:" $tmp/inc.d && grep -q "$tmp/dir/i-option-test.h" $tmp/inc.d
+check -MD
+./chibicc -I $tmp/dir -MD -MF $tmp/deps -o $tmp/inc.s $tmp/inc.c
+grep -q "$tmp/dir/i-option-test.h" $tmp/deps
+check -MF
+
+# --emit-prefix, --use-prefix
+cat <<EOF > $tmp/prefix.c
+typedef int myint;
+struct pt { int x; int y; };
+int gcount;
+int add(int a, int b);
+EOF
+cat $tmp/prefix.c - <<EOF > $tmp/use.c
+int add(int a, int b) { return a + b; }
+int main() { struct pt p; myint x = 3; p.y = 4; gcount = add(x, p.y); return gcount; }
+EOF
+./chibicc --emit-prefix $tmp/prefix.pfx $tmp/prefix.c
+./chibicc -o $tmp/use0.s $tmp/use.c
+./chibicc --use-prefix $tmp/prefix.pfx -o $tmp/use1.s $tmp/use.c
+cmp -s $tmp/use0.s $tmp/use1.s
+check --use-prefix
+tail -n 2 $tmp/use.c > $tmp/use2.c
+./chibicc --use-prefix $tmp/prefix.pfx -o $tmp/use2.s $tmp/use2.c 2>/dev/null
+[ $? -ne 0 ]
+check '--use-prefix mismatch'
+
+# 壊れたスナップショット。型が１つだけのスナップショットを作り、その型の
+# アラインメントを 0 にする。ハッシュ値の数はマジックナンバーの直後にある
+echo 'struct pt { int x; int y; };' > $tmp/pt.c
+echo 'int main() { struct pt p; p.x = 1; return p.x; }' | cat $tmp/pt.c - > $tmp/usept.c
+./chibicc --emit-prefix $tmp/pt.pfx $tmp/pt.c
+n=$(od -An -t d8 -j 17 -N 8 $tmp/pt.pfx)
+head -c 8 /dev/zero | dd of=$tmp/pt.pfx bs=1 seek=$((17 + 8 + 8 * n + 16 + 16)) conv=notrunc 2>/dev/null
+./chibicc --use-prefix $tmp/pt.pfx -o $tmp/usept.s $tmp/usept.c 2>&1 | grep -q 'スナップショットが壊れています'
+check '--use-prefix corrupted snapshot'
+
+# --declarations-only
+cat <<EOF > $tmp/decls.c
+typedef int myint;
+char buf[16];
+int add(int a, int b) { return a + b; }
+int main() { return add(1, 2) + ; }
+EOF
+./chibicc --declarations-only -o $tmp/decls.txt $tmp/decls.c
+grep -q '^typedef myint as int$' $tmp/decls.txt &&
+    grep -q '^declare buf as array 16 of char$' $tmp/decls.txt &&
+    grep -q '^define add as function (int, int) returning int$' $tmp/decls.txt
+check --declarations-only
+
+# --lazy-bodies（読み飛ばした本体を parse_function_body で読み直す）
+for t in arith struct strings; do
+    ./chibicc -Itest -o $tmp/eager.s test/$t.c &&
+        ./chibicc --lazy-bodies -Itest -o $tmp/lazy.s test/$t.c &&
+        cmp -s $tmp/eager.s $tmp/lazy.s
+    check "--lazy-bodies $t"
+done
+
+# 本体の中の指令や、本体の後で定義し直したマクロがあれば読み直せない
+printf 'int f() {\n#define X 1\n return X; }\n' > $tmp/lazy1.c
+printf '#define X 1\nint f() { return X; }\n#undef X\n#define X 2\n' > $tmp/lazy2.c
+for f in lazy1 lazy2; do
+    ./chibicc --lazy-bodies -o $tmp/$f.s $tmp/$f.c 2>&1 | grep -q '本体を読み直せません'
+    check "--lazy-bodies $f"
+done
+
+# 深くネストした括弧
+n=100000
+{ printf 'int main() { return '; printf "%${n}s" | tr ' ' '('; printf 7; printf "%${n}s" | tr ' ' ')'; echo '; }'; } > $tmp/deep.c
+./chibicc -o $tmp/deep.s $tmp/deep.c
+check 'deeply nested parentheses'
+
+# 文字列リテラルの中のエスケープされた改行も行として数える
+printf 'int main() {\n  char *s = "ab\\\ncd";\n  return x;\n}\n' > $tmp/line.c
+./chibicc -o $tmp/line.s $tmp/line.c 2>&1 | grep -q "^$tmp/line.c:4:   return x;"
+check 'line number after backslash-newline in string'
+
+# #error はメッセージを表示する
+printf '#error  too   "old" compiler\n' > $tmp/error.c
+./chibicc -o $tmp/error.s $tmp/error.c 2>&1 | grep -q '#error too "old" compiler$'
+check '#error message'
+
+# #if の定数式で、オーバーフローする除算はエラーにする
+for op in / %; do
+    printf '#if (-9223372036854775807-1) %s -1\n#endif\n' $op > $tmp/ifdiv.c
+    ./chibicc -o $tmp/ifdiv.s $tmp/ifdiv.c 2>&1 | grep -q '除算がオーバーフローしています'
+    check "#if overflowing $op"
+done
+
+# 複数のエラーの報告
+cat <<EOF > $tmp/errors.c
+int f() { int x = ; return 1; }
+int g() { y; if (1) { z; } return 2 }
+int main() { return f() + ; }
+EOF
+./chibicc -o $tmp/errors.s $tmp/errors.c 2> $tmp/errors.txt
+[ $? -ne 0 ] && [ "$(grep -c '\^' $tmp/errors.txt)" = 5 ]
+check 'multiple errors'
+./chibicc -fmax-errors=2 -o $tmp/errors.s $tmp/errors.c 2> $tmp/errors.txt
+[ $? -ne 0 ] && [ "$(grep -c '\^' $tmp/errors.txt)" = 2 ]
+check -fmax-errors
+
+# --edit
+cat <<EOF > $tmp/edit.c
+#define N 2
+int g;
+int f(int a) { return a + N; }
+int main() { return f(g); }
+EOF
+edit_test() {
+    o=$(grep -bo "$1" $tmp/edit.c | cut -d: -f1)
+    sed "s/$1/$2/" $tmp/edit.c > $tmp/edit1.c
+    ./chibicc --edit "$o,$((o + ${#1})),$2" -o $tmp/edit0.s $tmp/edit.c &&
+        ./chibicc -o $tmp/edit1.s $tmp/edit1.c &&
+        cmp -s <(grep -v '\.file' $tmp/edit0.s) <(grep -v '\.file' $tmp/edit1.s)
+}
+edit_test 'a + N' 'a * N'
+check '--edit function body'
+edit_test 'int g;' 'int h; int g;'
+check '--edit declaration'
+o=$(grep -bo 'int main' $tmp/edit.c | cut -d: -f1)
+./chibicc --edit "$o,$o,#define M 1
+" -o $tmp/edit0.s $tmp/edit.c 2>/dev/null
+[ $? -ne 0 ]
+check '--edit directive'
+
+# --emit-ast, --load-ast
+./chibicc --emit-ast -o $tmp/struct.ast test/struct.c &&
+    ./chibicc --load-ast -o $tmp/struct1.s $tmp/struct.ast &&
+    ./chibicc -o $tmp/struct0.s test/struct.c &&
+    cmp -s $tmp/struct0.s $tmp/struct1.s
+check '--load-ast'
+head -c 100 $tmp/struct.ast > $tmp/broken.ast
+./chibicc --load-ast -o $tmp/broken.s $tmp/broken.ast 2>/dev/null
+[ $? -ne 0 ]
+check '--load-ast broken file'
+
+# 表のレコードの中身が壊れた AST ファイル。`patch_ast <表> <バイト位置> [<値>]` は
+# ヘッダの <表> 番目の表のレコードの <バイト位置> に 4 バイトの値（printf の書式。
+# 既定はゼロ）を書き込む。corrupt_ast は書き換えたファイルが壊れていると報告されることを確かめる
+patch_ast() {
+    cp $tmp/small.ast $tmp/corrupt.ast
+    off=$(od -An -t d8 -j $((16 + 16 * $1)) -N 8 $tmp/small.ast)
+    printf "${3:-\\0\\0\\0\\0}" | dd of=$tmp/corrupt.ast bs=1 seek=$((off + $2)) conv=notrunc 2>/dev/null
+}
+corrupt_ast() {
+    patch_ast "$@"
+    ./chibicc --load-ast -o $tmp/corrupt.s $tmp/corrupt.ast 2>&1 | grep -q 'AST ファイルが壊れています'
+}
+echo 'int main() { int x; x = 3; return x; }' > $tmp/small.c
+./chibicc --emit-ast -o $tmp/small.ast $tmp/small.c
+corrupt_ast 2 48     # int のアラインメントを 0 にする
+check '--load-ast corrupted align'
+corrupt_ast 5 32     # ローカル変数 x の next を関数 main にする
+check '--load-ast corrupted next'
+corrupt_ast 6 64 '\021\0\0\0'    # 代入の式を複文にする
+check '--load-ast statement in expression'
+
+# 行の数が大きくても、行の数だけメモリを使わない
+patch_ast 0 4 '\375\377\377\177'
+(ulimit -v 1000000; ./chibicc --load-ast -o $tmp/corrupt.s $tmp/corrupt.ast)
+check '--load-ast large line count'
+
+# 定数の畳み込み
+echo 'int main() { int a[4]; if (2-2) return 5; return 3*4+1 + a[0]*0; }' > $tmp/fold.c
+./chibicc -o $tmp/fold.s $tmp/fold.c
+grep -q 'mov $13, %rax' $tmp/fold.s && ! grep -q 'imul\|mov $5, \|je ' $tmp/fold.s
+check 'constant folding'
+
 echo OK
\ No newline at end of file
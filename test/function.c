@@ -39,6 +39,10 @@ int sub_short(short a, short b, short c) {
     return a - b - c;
 }
 
+int (paren_sub)(int x, int y) {
+    return x - y;
+}
+
 int main() {
     ASSERT(3, ret3());
     ASSERT(8, add2(3, 5));
@@ -55,6 +59,7 @@ int main() {
 
     ASSERT(1, sub_long(7, 3, 3));
     ASSERT(1, sub_short(7, 3, 3));
+    ASSERT(4, paren_sub(7, 3));
 
     printf("OK\n");
     return 0;
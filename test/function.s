@@ -0,0 +1,1101 @@
+.file 1 "test/function.c"
+.file 2 "test/test.h"
+  .globl ret3
+  .text
+ret3:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+  .loc 1 4
+  .loc 1 4
+  .loc 1 4
+  mov $3, %rax
+  jmp .L.return.ret3
+  .loc 1 5
+  .loc 1 5
+  mov $5, %rax
+  jmp .L.return.ret3
+.L.return.ret3:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl add2
+  .text
+add2:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+  mov %edi, -4(%rbp)
+  mov %esi, -8(%rbp)
+  .loc 1 9
+  .loc 1 9
+  .loc 1 9
+  .loc 1 9
+  lea -8(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 9
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  jmp .L.return.add2
+.L.return.add2:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl sub2
+  .text
+sub2:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+  mov %edi, -4(%rbp)
+  mov %esi, -8(%rbp)
+  .loc 1 13
+  .loc 1 13
+  .loc 1 13
+  .loc 1 13
+  lea -8(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 13
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  sub %rdi, %rax
+  jmp .L.return.sub2
+.L.return.sub2:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl add6
+  .text
+add6:
+  push %rbp
+  mov %rsp, %rbp
+  sub $32, %rsp
+  mov %edi, -4(%rbp)
+  mov %esi, -8(%rbp)
+  mov %edx, -12(%rbp)
+  mov %ecx, -16(%rbp)
+  mov %r8d, -20(%rbp)
+  mov %r9d, -24(%rbp)
+  .loc 1 17
+  .loc 1 17
+  .loc 1 17
+  .loc 1 17
+  lea -24(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 17
+  .loc 1 17
+  lea -20(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 17
+  .loc 1 17
+  lea -16(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 17
+  .loc 1 17
+  lea -12(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 17
+  .loc 1 17
+  lea -8(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 17
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+  jmp .L.return.add6
+.L.return.add6:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl addx
+  .text
+addx:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+  mov %rdi, -8(%rbp)
+  mov %esi, -12(%rbp)
+  .loc 1 21
+  .loc 1 21
+  .loc 1 21
+  .loc 1 21
+  lea -12(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 21
+  .loc 1 21
+  lea -8(%rbp), %rax
+  mov (%rax), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  jmp .L.return.addx
+.L.return.addx:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl sub_char
+  .text
+sub_char:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+  mov %dil, -1(%rbp)
+  mov %sil, -2(%rbp)
+  mov %dl, -3(%rbp)
+  .loc 1 25
+  .loc 1 25
+  .loc 1 25
+  .loc 1 25
+  lea -3(%rbp), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 1 25
+  .loc 1 25
+  lea -2(%rbp), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 1 25
+  lea -1(%rbp), %rax
+  movsbq (%rax), %rax
+  pop %rdi
+  sub %rdi, %rax
+  pop %rdi
+  sub %rdi, %rax
+  jmp .L.return.sub_char
+.L.return.sub_char:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl fib
+  .text
+fib:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+  mov %edi, -4(%rbp)
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  mov $1, %rax
+  push %rax
+  .loc 1 29
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  cmp %rdi, %rax
+  setle %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je .L.else.1
+  .loc 1 30
+  .loc 1 30
+  mov $1, %rax
+  jmp .L.return.fib
+  jmp .L.end.1
+.L.else.1:
+.L.end.1:
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  mov $2, %rax
+  push %rax
+  .loc 1 31
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  sub %rdi, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call fib
+  push %rax
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  mov $1, %rax
+  push %rax
+  .loc 1 31
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  sub %rdi, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call fib
+  pop %rdi
+  add %rdi, %rax
+  jmp .L.return.fib
+.L.return.fib:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl sub_long
+  .text
+sub_long:
+  push %rbp
+  mov %rsp, %rbp
+  sub $32, %rsp
+  mov %rdi, -8(%rbp)
+  mov %rsi, -16(%rbp)
+  mov %rdx, -24(%rbp)
+  .loc 1 35
+  .loc 1 35
+  .loc 1 35
+  .loc 1 35
+  lea -24(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  .loc 1 35
+  .loc 1 35
+  lea -16(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  .loc 1 35
+  lea -8(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  sub %rdi, %rax
+  pop %rdi
+  sub %rdi, %rax
+  jmp .L.return.sub_long
+.L.return.sub_long:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl sub_short
+  .text
+sub_short:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+  mov %di, -2(%rbp)
+  mov %si, -4(%rbp)
+  mov %dx, -6(%rbp)
+  .loc 1 39
+  .loc 1 39
+  .loc 1 39
+  .loc 1 39
+  lea -6(%rbp), %rax
+  movswq (%rax), %rax
+  push %rax
+  .loc 1 39
+  .loc 1 39
+  lea -4(%rbp), %rax
+  movswq (%rax), %rax
+  push %rax
+  .loc 1 39
+  lea -2(%rbp), %rax
+  movswq (%rax), %rax
+  pop %rdi
+  sub %rdi, %rax
+  pop %rdi
+  sub %rdi, %rax
+  jmp .L.return.sub_short
+.L.return.sub_short:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl paren_sub
+  .text
+paren_sub:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+  mov %edi, -4(%rbp)
+  mov %esi, -8(%rbp)
+  .loc 1 43
+  .loc 1 43
+  .loc 1 43
+  .loc 1 43
+  lea -8(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 43
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  sub %rdi, %rax
+  jmp .L.return.paren_sub
+.L.return.paren_sub:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+  .loc 2 1
+  .loc 2 1
+  .loc 2 1
+  .loc 1 47
+  mov $3, %rax
+  push %rax
+  .loc 1 47
+  mov $0, %rax
+  call ret3
+  push %rax
+  .loc 2 1
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 48
+  mov $8, %rax
+  push %rax
+  .loc 1 48
+  .loc 1 48
+  mov $3, %rax
+  push %rax
+  .loc 1 48
+  mov $5, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add2
+  push %rax
+  .loc 2 1
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 49
+  mov $2, %rax
+  push %rax
+  .loc 1 49
+  .loc 1 49
+  mov $5, %rax
+  push %rax
+  .loc 1 49
+  mov $3, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call sub2
+  push %rax
+  .loc 2 1
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 50
+  mov $21, %rax
+  push %rax
+  .loc 1 50
+  .loc 1 50
+  mov $1, %rax
+  push %rax
+  .loc 1 50
+  mov $2, %rax
+  push %rax
+  .loc 1 50
+  mov $3, %rax
+  push %rax
+  .loc 1 50
+  mov $4, %rax
+  push %rax
+  .loc 1 50
+  mov $5, %rax
+  push %rax
+  .loc 1 50
+  mov $6, %rax
+  push %rax
+  pop %r9
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add6
+  push %rax
+  .loc 2 1
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 51
+  mov $66, %rax
+  push %rax
+  .loc 1 51
+  .loc 1 51
+  mov $1, %rax
+  push %rax
+  .loc 1 51
+  mov $2, %rax
+  push %rax
+  .loc 1 51
+  .loc 1 51
+  mov $3, %rax
+  push %rax
+  .loc 1 51
+  mov $4, %rax
+  push %rax
+  .loc 1 51
+  mov $5, %rax
+  push %rax
+  .loc 1 51
+  mov $6, %rax
+  push %rax
+  .loc 1 51
+  mov $7, %rax
+  push %rax
+  .loc 1 51
+  mov $8, %rax
+  push %rax
+  pop %r9
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add6
+  push %rax
+  .loc 1 51
+  mov $9, %rax
+  push %rax
+  .loc 1 51
+  mov $10, %rax
+  push %rax
+  .loc 1 51
+  mov $11, %rax
+  push %rax
+  pop %r9
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add6
+  push %rax
+  .loc 2 1
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 52
+  mov $136, %rax
+  push %rax
+  .loc 1 52
+  .loc 1 52
+  mov $1, %rax
+  push %rax
+  .loc 1 52
+  mov $2, %rax
+  push %rax
+  .loc 1 52
+  .loc 1 52
+  mov $3, %rax
+  push %rax
+  .loc 1 52
+  .loc 1 52
+  mov $4, %rax
+  push %rax
+  .loc 1 52
+  mov $5, %rax
+  push %rax
+  .loc 1 52
+  mov $6, %rax
+  push %rax
+  .loc 1 52
+  mov $7, %rax
+  push %rax
+  .loc 1 52
+  mov $8, %rax
+  push %rax
+  .loc 1 52
+  mov $9, %rax
+  push %rax
+  pop %r9
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add6
+  push %rax
+  .loc 1 52
+  mov $10, %rax
+  push %rax
+  .loc 1 52
+  mov $11, %rax
+  push %rax
+  .loc 1 52
+  mov $12, %rax
+  push %rax
+  .loc 1 52
+  mov $13, %rax
+  push %rax
+  pop %r9
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add6
+  push %rax
+  .loc 1 52
+  mov $14, %rax
+  push %rax
+  .loc 1 52
+  mov $15, %rax
+  push %rax
+  .loc 1 52
+  mov $16, %rax
+  push %rax
+  pop %r9
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add6
+  push %rax
+  .loc 2 1
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 54
+  mov $7, %rax
+  push %rax
+  .loc 1 54
+  .loc 1 54
+  mov $3, %rax
+  push %rax
+  .loc 1 54
+  mov $4, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call add2
+  push %rax
+  .loc 2 1
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 55
+  mov $1, %rax
+  push %rax
+  .loc 1 55
+  .loc 1 55
+  mov $4, %rax
+  push %rax
+  .loc 1 55
+  mov $3, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call sub2
+  push %rax
+  .loc 2 1
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 56
+  mov $55, %rax
+  push %rax
+  .loc 1 56
+  .loc 1 56
+  mov $9, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call fib
+  push %rax
+  .loc 2 1
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 58
+  mov $1, %rax
+  push %rax
+  .loc 1 58
+  .loc 1 58
+  mov $7, %rax
+  push %rax
+  .loc 1 58
+  mov $3, %rax
+  push %rax
+  .loc 1 58
+  mov $3, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call sub_char
+  push %rax
+  .loc 2 1
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 60
+  mov $1, %rax
+  push %rax
+  .loc 1 60
+  .loc 1 60
+  mov $7, %rax
+  push %rax
+  .loc 1 60
+  mov $3, %rax
+  push %rax
+  .loc 1 60
+  mov $3, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call sub_long
+  push %rax
+  .loc 2 1
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 61
+  mov $1, %rax
+  push %rax
+  .loc 1 61
+  .loc 1 61
+  mov $7, %rax
+  push %rax
+  .loc 1 61
+  mov $3, %rax
+  push %rax
+  .loc 1 61
+  mov $3, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call sub_short
+  push %rax
+  .loc 2 1
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 62
+  mov $4, %rax
+  push %rax
+  .loc 1 62
+  .loc 1 62
+  mov $7, %rax
+  push %rax
+  .loc 1 62
+  mov $3, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call paren_sub
+  push %rax
+  .loc 2 1
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 64
+  .loc 1 64
+  .loc 1 64
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+  .loc 1 65
+  .loc 1 65
+  mov $0, %rax
+  jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .data
+  .global .L..13
+.L..13:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .data
+  .global .L..12
+.L..12:
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 101
+  .byte 110
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .data
+  .global .L..11
+.L..11:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .data
+  .global .L..10
+.L..10:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .data
+  .global .L..9
+.L..9:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .data
+  .global .L..8
+.L..8:
+  .byte 102
+  .byte 105
+  .byte 98
+  .byte 40
+  .byte 57
+  .byte 41
+  .byte 0
+  .data
+  .global .L..7
+.L..7:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 50
+  .byte 40
+  .byte 52
+  .byte 44
+  .byte 51
+  .byte 41
+  .byte 0
+  .data
+  .global .L..6
+.L..6:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 41
+  .byte 0
+  .data
+  .global .L..5
+.L..5:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 57
+  .byte 41
+  .byte 44
+  .byte 49
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 49
+  .byte 44
+  .byte 49
+  .byte 50
+  .byte 44
+  .byte 49
+  .byte 51
+  .byte 41
+  .byte 44
+  .byte 49
+  .byte 52
+  .byte 44
+  .byte 49
+  .byte 53
+  .byte 44
+  .byte 49
+  .byte 54
+  .byte 41
+  .byte 0
+  .data
+  .global .L..4
+.L..4:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 41
+  .byte 44
+  .byte 57
+  .byte 44
+  .byte 49
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 49
+  .byte 41
+  .byte 0
+  .data
+  .global .L..3
+.L..3:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 41
+  .byte 0
+  .data
+  .global .L..2
+.L..2:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 50
+  .byte 40
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .data
+  .global .L..1
+.L..1:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .data
+  .global .L..0
+.L..0:
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 51
+  .byte 40
+  .byte 41
+  .byte 0
@@ -0,0 +1,8 @@
+#ifndef INCLUDE1_H
+#define INCLUDE1_H
+
+int include1_count;
+
+#define INCLUDE1 5
+
+#endif
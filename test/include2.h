@@ -0,0 +1,3 @@
+#pragma once
+
+int include2_count;
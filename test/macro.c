@@ -0,0 +1,101 @@
+#include "test.h"
+#include "include1.h"
+#include "include1.h"
+#include "include2.h"
+#include "include2.h"
+
+int ret3() { return 3; }
+int dbl(int x) { return x*2; }
+
+int main() {
+    ASSERT(5, INCLUDE1);
+    ASSERT(0, include1_count);
+    ASSERT(0, include2_count);
+
+#define M1 3
+    ASSERT(3, M1);
+#define M1 4
+    ASSERT(4, M1);
+
+#define M2 M1+M1
+    ASSERT(8, M2);
+#undef M1
+    ASSERT(0, ({ int M1=0; M1; }));
+
+    int m3 = 2;
+#define m3 m3+1
+    ASSERT(3, m3);
+#undef m3
+
+#define ADD(x, y) x+y
+    ASSERT(7, ADD(3, 4));
+    ASSERT(15, ADD(3, 4)*3);
+    ASSERT(12, ADD((1+2), ADD(4, 5)));
+#define ADD_P(x, y) ((x)+(y))
+    ASSERT(21, ADD_P(3, 4)*3);
+
+#define CALL(f) f()
+    ASSERT(3, CALL(ret3));
+#define dbl(x) dbl(x+1)
+    ASSERT(8, dbl(3));
+#undef dbl
+#define F dbl
+    ASSERT(6, F(3));
+
+#define STR(x) #x
+    ASSERT(6, sizeof(STR(a + b)));
+    ASSERT(98, STR(a b)[2]);
+    ASSERT(34, STR("x")[0]);
+
+#define CAT(x, y) x##y
+    ASSERT(12, CAT(1, 2));
+    ASSERT(3, CAT(re, t3)());
+    ASSERT(5, CAT(, 5));
+    ASSERT(5, CAT(5, ));
+
+#define VA(x, ...) x + dbl(__VA_ARGS__)
+    ASSERT(7, VA(1, 3));
+
+    int m = 0;
+#if 1
+    m = 1;
+#else
+    m = 2;
+#endif
+    ASSERT(1, m);
+
+#if 0
+    m = 3;
+#if 1
+    m = 4;
+#endif
+    this is skipped;
+#elif 1 + 1 == 2 && !0
+    m = 5;
+#else
+    m = 6;
+#endif
+    ASSERT(5, m);
+
+#ifdef M2
+    m = 7;
+#endif
+    ASSERT(7, m);
+
+#ifndef M2
+    m = 8;
+#elif defined(INCLUDE1) && defined INCLUDE1_H
+    m = 9;
+#endif
+    ASSERT(9, m);
+
+#if UNDEFINED_MACRO || (2 * 3 - 6)
+    m = 10;
+#elif M2 == 0 ? 1 : 0
+    m = 11;
+#endif
+    ASSERT(11, m);
+
+    printf("OK\n");
+    return 0;
+}
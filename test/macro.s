@@ -0,0 +1,1008 @@
+.file 1 "test/macro.c"
+.file 2 "test/test.h"
+.file 3 "test/include1.h"
+.file 4 "test/include2.h"
+  .globl ret3
+  .text
+ret3:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+  .loc 1 7
+  .loc 1 7
+  .loc 1 7
+  mov $3, %rax
+  jmp .L.return.ret3
+.L.return.ret3:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl dbl
+  .text
+dbl:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+  mov %edi, -4(%rbp)
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  mov $2, %rax
+  push %rax
+  .loc 1 8
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  imul %rdi, %rax
+  jmp .L.return.dbl
+.L.return.dbl:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $16, %rsp
+  .loc 2 1
+  .loc 2 1
+  .loc 2 1
+  .loc 1 11
+  mov $5, %rax
+  push %rax
+  .loc 3 6
+  mov $5, %rax
+  push %rax
+  .loc 2 1
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 12
+  mov $0, %rax
+  push %rax
+  .loc 1 12
+  lea include1_count(%rip), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 13
+  mov $0, %rax
+  push %rax
+  .loc 1 13
+  lea include2_count(%rip), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 16
+  mov $3, %rax
+  push %rax
+  .loc 1 15
+  mov $3, %rax
+  push %rax
+  .loc 2 1
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 18
+  mov $4, %rax
+  push %rax
+  .loc 1 17
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 21
+  mov $8, %rax
+  push %rax
+  .loc 1 20
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 23
+  mov $0, %rax
+  push %rax
+  .loc 1 23
+  .loc 1 23
+  .loc 1 23
+  .loc 1 23
+  lea -12(%rbp), %rax
+  push %rax
+  .loc 1 23
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 23
+  .loc 1 23
+  lea -12(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 25
+  .loc 1 25
+  .loc 1 25
+  lea -8(%rbp), %rax
+  push %rax
+  .loc 1 25
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 2 1
+  .loc 2 1
+  .loc 1 27
+  mov $3, %rax
+  push %rax
+  .loc 1 26
+  .loc 1 26
+  mov $1, %rax
+  push %rax
+  .loc 1 26
+  lea -8(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 2 1
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 31
+  mov $7, %rax
+  push %rax
+  .loc 1 30
+  mov $7, %rax
+  push %rax
+  .loc 2 1
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 32
+  mov $15, %rax
+  push %rax
+  .loc 1 30
+  mov $15, %rax
+  push %rax
+  .loc 2 1
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 33
+  mov $12, %rax
+  push %rax
+  .loc 1 30
+  mov $12, %rax
+  push %rax
+  .loc 2 1
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 35
+  mov $21, %rax
+  push %rax
+  .loc 1 35
+  mov $21, %rax
+  push %rax
+  .loc 2 1
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 38
+  mov $3, %rax
+  push %rax
+  .loc 1 38
+  mov $0, %rax
+  call ret3
+  push %rax
+  .loc 2 1
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 40
+  mov $8, %rax
+  push %rax
+  .loc 1 39
+  .loc 1 39
+  mov $4, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call dbl
+  push %rax
+  .loc 2 1
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 43
+  mov $6, %rax
+  push %rax
+  .loc 1 42
+  .loc 1 43
+  mov $3, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call dbl
+  push %rax
+  .loc 2 1
+  lea .L..14(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 46
+  mov $6, %rax
+  push %rax
+  .loc 1 46
+  mov $6, %rax
+  push %rax
+  .loc 2 1
+  lea .L..16(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 47
+  mov $98, %rax
+  push %rax
+  .loc 1 47
+  .loc 1 47
+  .loc 1 47
+  mov $2, %rax
+  push %rax
+  .loc 1 1
+  lea .L..17(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..18(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 48
+  mov $34, %rax
+  push %rax
+  .loc 1 48
+  .loc 1 1
+  lea .L..19(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..20(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 51
+  mov $12, %rax
+  push %rax
+  .loc 1 1
+  mov $12, %rax
+  push %rax
+  .loc 2 1
+  lea .L..21(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 52
+  mov $3, %rax
+  push %rax
+  .loc 1 1
+  mov $0, %rax
+  call ret3
+  push %rax
+  .loc 2 1
+  lea .L..22(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 53
+  mov $5, %rax
+  push %rax
+  .loc 1 53
+  mov $5, %rax
+  push %rax
+  .loc 2 1
+  lea .L..23(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 54
+  mov $5, %rax
+  push %rax
+  .loc 1 54
+  mov $5, %rax
+  push %rax
+  .loc 2 1
+  lea .L..24(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 57
+  mov $7, %rax
+  push %rax
+  .loc 1 56
+  .loc 1 56
+  .loc 1 57
+  mov $3, %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call dbl
+  push %rax
+  .loc 1 57
+  mov $1, %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 2 1
+  lea .L..25(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 59
+  .loc 1 59
+  .loc 1 59
+  lea -4(%rbp), %rax
+  push %rax
+  .loc 1 59
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 61
+  .loc 1 61
+  lea -4(%rbp), %rax
+  push %rax
+  .loc 1 61
+  mov $1, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 2 1
+  .loc 2 1
+  .loc 1 65
+  mov $1, %rax
+  push %rax
+  .loc 1 65
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..26(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 74
+  .loc 1 74
+  lea -4(%rbp), %rax
+  push %rax
+  .loc 1 74
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 2 1
+  .loc 2 1
+  .loc 1 78
+  mov $5, %rax
+  push %rax
+  .loc 1 78
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..27(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 81
+  .loc 1 81
+  lea -4(%rbp), %rax
+  push %rax
+  .loc 1 81
+  mov $7, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 2 1
+  .loc 2 1
+  .loc 1 83
+  mov $7, %rax
+  push %rax
+  .loc 1 83
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..28(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 88
+  .loc 1 88
+  lea -4(%rbp), %rax
+  push %rax
+  .loc 1 88
+  mov $9, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 2 1
+  .loc 2 1
+  .loc 1 90
+  mov $9, %rax
+  push %rax
+  .loc 1 90
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..29(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 95
+  .loc 1 95
+  lea -4(%rbp), %rax
+  push %rax
+  .loc 1 95
+  mov $11, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 2 1
+  .loc 2 1
+  .loc 1 97
+  mov $11, %rax
+  push %rax
+  .loc 1 97
+  lea -4(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..30(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 99
+  .loc 1 99
+  .loc 1 99
+  lea .L..31(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+  .loc 1 100
+  .loc 1 100
+  mov $0, %rax
+  jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .data
+  .global .L..31
+.L..31:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .data
+  .global .L..30
+.L..30:
+  .byte 109
+  .byte 0
+  .data
+  .global .L..29
+.L..29:
+  .byte 109
+  .byte 0
+  .data
+  .global .L..28
+.L..28:
+  .byte 109
+  .byte 0
+  .data
+  .global .L..27
+.L..27:
+  .byte 109
+  .byte 0
+  .data
+  .global .L..26
+.L..26:
+  .byte 109
+  .byte 0
+  .data
+  .global .L..25
+.L..25:
+  .byte 86
+  .byte 65
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .data
+  .global .L..24
+.L..24:
+  .byte 67
+  .byte 65
+  .byte 84
+  .byte 40
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 41
+  .byte 0
+  .data
+  .global .L..23
+.L..23:
+  .byte 67
+  .byte 65
+  .byte 84
+  .byte 40
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .data
+  .global .L..22
+.L..22:
+  .byte 67
+  .byte 65
+  .byte 84
+  .byte 40
+  .byte 114
+  .byte 101
+  .byte 44
+  .byte 32
+  .byte 116
+  .byte 51
+  .byte 41
+  .byte 40
+  .byte 41
+  .byte 0
+  .data
+  .global .L..21
+.L..21:
+  .byte 67
+  .byte 65
+  .byte 84
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 0
+  .data
+  .global .L..20
+.L..20:
+  .byte 83
+  .byte 84
+  .byte 82
+  .byte 40
+  .byte 34
+  .byte 120
+  .byte 34
+  .byte 41
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..19
+.L..19:
+  .byte 34
+  .byte 120
+  .byte 34
+  .byte 0
+  .data
+  .global .L..18
+.L..18:
+  .byte 83
+  .byte 84
+  .byte 82
+  .byte 40
+  .byte 97
+  .byte 32
+  .byte 98
+  .byte 41
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+  .data
+  .global .L..17
+.L..17:
+  .byte 97
+  .byte 32
+  .byte 98
+  .byte 0
+  .data
+  .global .L..16
+.L..16:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 83
+  .byte 84
+  .byte 82
+  .byte 40
+  .byte 97
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 98
+  .byte 41
+  .byte 41
+  .byte 0
+  .data
+  .global .L..15
+.L..15:
+  .byte 97
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 98
+  .byte 0
+  .data
+  .global .L..14
+.L..14:
+  .byte 70
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+  .data
+  .global .L..13
+.L..13:
+  .byte 100
+  .byte 98
+  .byte 108
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+  .data
+  .global .L..12
+.L..12:
+  .byte 67
+  .byte 65
+  .byte 76
+  .byte 76
+  .byte 40
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 51
+  .byte 41
+  .byte 0
+  .data
+  .global .L..11
+.L..11:
+  .byte 65
+  .byte 68
+  .byte 68
+  .byte 95
+  .byte 80
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 42
+  .byte 51
+  .byte 0
+  .data
+  .global .L..10
+.L..10:
+  .byte 65
+  .byte 68
+  .byte 68
+  .byte 40
+  .byte 40
+  .byte 49
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 65
+  .byte 68
+  .byte 68
+  .byte 40
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 41
+  .byte 0
+  .data
+  .global .L..9
+.L..9:
+  .byte 65
+  .byte 68
+  .byte 68
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 42
+  .byte 51
+  .byte 0
+  .data
+  .global .L..8
+.L..8:
+  .byte 65
+  .byte 68
+  .byte 68
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 0
+  .data
+  .global .L..7
+.L..7:
+  .byte 109
+  .byte 51
+  .byte 0
+  .data
+  .global .L..6
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 77
+  .byte 49
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 77
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..5
+.L..5:
+  .byte 77
+  .byte 50
+  .byte 0
+  .data
+  .global .L..4
+.L..4:
+  .byte 77
+  .byte 49
+  .byte 0
+  .data
+  .global .L..3
+.L..3:
+  .byte 77
+  .byte 49
+  .byte 0
+  .data
+  .global .L..2
+.L..2:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 117
+  .byte 100
+  .byte 101
+  .byte 50
+  .byte 95
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 0
+  .data
+  .global .L..1
+.L..1:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 108
+  .byte 117
+  .byte 100
+  .byte 101
+  .byte 49
+  .byte 95
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 0
+  .data
+  .global .L..0
+.L..0:
+  .byte 73
+  .byte 78
+  .byte 67
+  .byte 76
+  .byte 85
+  .byte 68
+  .byte 69
+  .byte 49
+  .byte 0
+  .data
+  .global include2_count
+include2_count:
+  .zero 4
+  .data
+  .global include1_count
+include1_count:
+  .zero 4
@@ -0,0 +1,3025 @@
+.file 1 "test/pointer.c"
+.file 2 "test/test.h"
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $592, %rsp
+  .loc 2 1
+  .loc 2 1
+  .loc 2 1
+  .loc 1 4
+  mov $3, %rax
+  push %rax
+  .loc 1 4
+  .loc 1 4
+  .loc 1 4
+  .loc 1 4
+  lea -592(%rbp), %rax
+  push %rax
+  .loc 1 4
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 4
+  .loc 1 4
+  .loc 1 4
+  lea -592(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 5
+  mov $3, %rax
+  push %rax
+  .loc 1 5
+  .loc 1 5
+  .loc 1 5
+  .loc 1 5
+  lea -588(%rbp), %rax
+  push %rax
+  .loc 1 5
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 5
+  .loc 1 5
+  .loc 1 5
+  lea -584(%rbp), %rax
+  push %rax
+  .loc 1 5
+  lea -588(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 5
+  .loc 1 5
+  .loc 1 5
+  lea -576(%rbp), %rax
+  push %rax
+  .loc 1 5
+  lea -584(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 5
+  .loc 1 5
+  .loc 1 5
+  .loc 1 5
+  lea -576(%rbp), %rax
+  mov (%rax), %rax
+  mov (%rax), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 6
+  mov $5, %rax
+  push %rax
+  .loc 1 6
+  .loc 1 6
+  .loc 1 6
+  .loc 1 6
+  lea -564(%rbp), %rax
+  push %rax
+  .loc 1 6
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 6
+  .loc 1 6
+  .loc 1 6
+  lea -560(%rbp), %rax
+  push %rax
+  .loc 1 6
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 6
+  .loc 1 6
+  .loc 1 6
+  .loc 1 6
+  mov $4, %rax
+  push %rax
+  .loc 1 6
+  lea -564(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 7
+  mov $3, %rax
+  push %rax
+  .loc 1 7
+  .loc 1 7
+  .loc 1 7
+  .loc 1 7
+  lea -556(%rbp), %rax
+  push %rax
+  .loc 1 7
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 7
+  .loc 1 7
+  .loc 1 7
+  lea -552(%rbp), %rax
+  push %rax
+  .loc 1 7
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 7
+  .loc 1 7
+  .loc 1 7
+  .loc 1 7
+  mov $4, %rax
+  push %rax
+  .loc 1 7
+  lea -552(%rbp), %rax
+  pop %rdi
+  sub %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 8
+  mov $5, %rax
+  push %rax
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  lea -548(%rbp), %rax
+  push %rax
+  .loc 1 8
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  lea -544(%rbp), %rax
+  push %rax
+  .loc 1 8
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  mov $-4, %rax
+  push %rax
+  .loc 1 8
+  lea -548(%rbp), %rax
+  pop %rdi
+  sub %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 9
+  mov $5, %rax
+  push %rax
+  .loc 1 9
+  .loc 1 9
+  .loc 1 9
+  .loc 1 9
+  lea -540(%rbp), %rax
+  push %rax
+  .loc 1 9
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 9
+  .loc 1 9
+  .loc 1 9
+  lea -536(%rbp), %rax
+  push %rax
+  .loc 1 9
+  lea -540(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 9
+  .loc 1 9
+  .loc 1 9
+  lea -536(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  .loc 1 9
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 9
+  .loc 1 9
+  lea -540(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 10
+  mov $7, %rax
+  push %rax
+  .loc 1 10
+  .loc 1 10
+  .loc 1 10
+  .loc 1 10
+  lea -524(%rbp), %rax
+  push %rax
+  .loc 1 10
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 10
+  .loc 1 10
+  .loc 1 10
+  lea -520(%rbp), %rax
+  push %rax
+  .loc 1 10
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 10
+  .loc 1 10
+  .loc 1 10
+  .loc 1 10
+  mov $4, %rax
+  push %rax
+  .loc 1 10
+  lea -524(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 10
+  mov $7, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 10
+  .loc 1 10
+  lea -520(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 11
+  mov $7, %rax
+  push %rax
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  lea -516(%rbp), %rax
+  push %rax
+  .loc 1 11
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  lea -512(%rbp), %rax
+  push %rax
+  .loc 1 11
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  mov $4, %rax
+  push %rax
+  .loc 1 11
+  .loc 1 11
+  mov $8, %rax
+  push %rax
+  .loc 1 11
+  lea -512(%rbp), %rax
+  pop %rdi
+  sub %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 11
+  mov $7, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 11
+  .loc 1 11
+  lea -516(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 12
+  mov $5, %rax
+  push %rax
+  .loc 1 12
+  .loc 1 12
+  .loc 1 12
+  .loc 1 12
+  lea -508(%rbp), %rax
+  push %rax
+  .loc 1 12
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 12
+  .loc 1 12
+  .loc 1 12
+  mov $3, %rax
+  push %rax
+  .loc 1 12
+  .loc 1 12
+  mov $4, %rax
+  push %rax
+  .loc 1 12
+  .loc 1 12
+  lea -508(%rbp), %rax
+  push %rax
+  .loc 1 12
+  .loc 1 12
+  mov $8, %rax
+  push %rax
+  .loc 1 12
+  lea -508(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  sub %rdi, %rax
+  pop %rdi
+  cqo
+  idiv %rdi
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 2 1
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 13
+  mov $8, %rax
+  push %rax
+  .loc 1 13
+  .loc 1 13
+  .loc 1 13
+  lea -504(%rbp), %rax
+  push %rax
+  .loc 1 13
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 13
+  .loc 1 13
+  lea -500(%rbp), %rax
+  push %rax
+  .loc 1 13
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 13
+  .loc 1 13
+  .loc 1 13
+  lea -500(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 13
+  lea -504(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 2 1
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 14
+  mov $8, %rax
+  push %rax
+  .loc 1 14
+  .loc 1 14
+  .loc 1 14
+  .loc 1 14
+  lea -496(%rbp), %rax
+  push %rax
+  .loc 1 14
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 14
+  .loc 1 14
+  lea -492(%rbp), %rax
+  push %rax
+  .loc 1 14
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 14
+  .loc 1 14
+  .loc 1 14
+  lea -492(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 14
+  lea -496(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 2 1
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 16
+  mov $3, %rax
+  push %rax
+  .loc 1 16
+  .loc 1 16
+  .loc 1 16
+  .loc 1 16
+  lea -480(%rbp), %rax
+  push %rax
+  .loc 1 16
+  lea -488(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 16
+  .loc 1 16
+  .loc 1 16
+  lea -480(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  .loc 1 16
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 16
+  .loc 1 16
+  .loc 1 16
+  lea -488(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 18
+  mov $3, %rax
+  push %rax
+  .loc 1 18
+  .loc 1 18
+  .loc 1 18
+  .loc 1 18
+  lea -468(%rbp), %rax
+  push %rax
+  .loc 1 18
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 18
+  .loc 1 18
+  .loc 1 18
+  .loc 1 18
+  mov $4, %rax
+  push %rax
+  .loc 1 18
+  lea -468(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 18
+  mov $4, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 18
+  .loc 1 18
+  .loc 1 18
+  .loc 1 18
+  mov $8, %rax
+  push %rax
+  .loc 1 18
+  lea -468(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 18
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 18
+  .loc 1 18
+  .loc 1 18
+  lea -468(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 19
+  mov $4, %rax
+  push %rax
+  .loc 1 19
+  .loc 1 19
+  .loc 1 19
+  .loc 1 19
+  lea -456(%rbp), %rax
+  push %rax
+  .loc 1 19
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 19
+  .loc 1 19
+  .loc 1 19
+  .loc 1 19
+  mov $4, %rax
+  push %rax
+  .loc 1 19
+  lea -456(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 19
+  mov $4, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 19
+  .loc 1 19
+  .loc 1 19
+  .loc 1 19
+  mov $8, %rax
+  push %rax
+  .loc 1 19
+  lea -456(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 19
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 19
+  .loc 1 19
+  .loc 1 19
+  .loc 1 19
+  mov $4, %rax
+  push %rax
+  .loc 1 19
+  lea -456(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 20
+  mov $5, %rax
+  push %rax
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  lea -444(%rbp), %rax
+  push %rax
+  .loc 1 20
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  mov $4, %rax
+  push %rax
+  .loc 1 20
+  lea -444(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 20
+  mov $4, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  mov $8, %rax
+  push %rax
+  .loc 1 20
+  lea -444(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 20
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  mov $8, %rax
+  push %rax
+  .loc 1 20
+  lea -444(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..14(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 22
+  mov $0, %rax
+  push %rax
+  .loc 1 22
+  .loc 1 22
+  .loc 1 22
+  .loc 1 22
+  lea -408(%rbp), %rax
+  push %rax
+  .loc 1 22
+  lea -432(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 22
+  .loc 1 22
+  .loc 1 22
+  lea -408(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  .loc 1 22
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 22
+  .loc 1 22
+  .loc 1 22
+  .loc 1 22
+  lea -432(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 23
+  mov $1, %rax
+  push %rax
+  .loc 1 23
+  .loc 1 23
+  .loc 1 23
+  .loc 1 23
+  lea -376(%rbp), %rax
+  push %rax
+  .loc 1 23
+  lea -400(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 23
+  .loc 1 23
+  .loc 1 23
+  .loc 1 23
+  mov $4, %rax
+  push %rax
+  .loc 1 23
+  lea -376(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 23
+  mov $1, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 23
+  .loc 1 23
+  .loc 1 23
+  .loc 1 23
+  mov $4, %rax
+  push %rax
+  .loc 1 23
+  .loc 1 23
+  lea -400(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..16(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 24
+  mov $2, %rax
+  push %rax
+  .loc 1 24
+  .loc 1 24
+  .loc 1 24
+  .loc 1 24
+  lea -344(%rbp), %rax
+  push %rax
+  .loc 1 24
+  lea -368(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 24
+  .loc 1 24
+  .loc 1 24
+  .loc 1 24
+  mov $8, %rax
+  push %rax
+  .loc 1 24
+  lea -344(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 24
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 24
+  .loc 1 24
+  .loc 1 24
+  .loc 1 24
+  mov $8, %rax
+  push %rax
+  .loc 1 24
+  .loc 1 24
+  lea -368(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..17(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 25
+  mov $3, %rax
+  push %rax
+  .loc 1 25
+  .loc 1 25
+  .loc 1 25
+  .loc 1 25
+  lea -312(%rbp), %rax
+  push %rax
+  .loc 1 25
+  lea -336(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 25
+  .loc 1 25
+  .loc 1 25
+  .loc 1 25
+  mov $12, %rax
+  push %rax
+  .loc 1 25
+  lea -312(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 25
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 25
+  .loc 1 25
+  .loc 1 25
+  .loc 1 25
+  .loc 1 25
+  mov $12, %rax
+  push %rax
+  .loc 1 25
+  lea -336(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..18(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 26
+  mov $4, %rax
+  push %rax
+  .loc 1 26
+  .loc 1 26
+  .loc 1 26
+  .loc 1 26
+  lea -280(%rbp), %rax
+  push %rax
+  .loc 1 26
+  lea -304(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 26
+  .loc 1 26
+  .loc 1 26
+  .loc 1 26
+  mov $16, %rax
+  push %rax
+  .loc 1 26
+  lea -280(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 26
+  mov $4, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 26
+  .loc 1 26
+  .loc 1 26
+  .loc 1 26
+  mov $4, %rax
+  push %rax
+  .loc 1 26
+  .loc 1 26
+  .loc 1 26
+  mov $12, %rax
+  push %rax
+  .loc 1 26
+  lea -304(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..19(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 27
+  mov $5, %rax
+  push %rax
+  .loc 1 27
+  .loc 1 27
+  .loc 1 27
+  .loc 1 27
+  lea -248(%rbp), %rax
+  push %rax
+  .loc 1 27
+  lea -272(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 27
+  .loc 1 27
+  .loc 1 27
+  .loc 1 27
+  mov $20, %rax
+  push %rax
+  .loc 1 27
+  lea -248(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 27
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 27
+  .loc 1 27
+  .loc 1 27
+  .loc 1 27
+  mov $8, %rax
+  push %rax
+  .loc 1 27
+  .loc 1 27
+  .loc 1 27
+  mov $12, %rax
+  push %rax
+  .loc 1 27
+  lea -272(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..20(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 29
+  mov $3, %rax
+  push %rax
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  lea -240(%rbp), %rax
+  push %rax
+  .loc 1 29
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  mov $4, %rax
+  push %rax
+  .loc 1 29
+  lea -240(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 29
+  mov $4, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  mov $8, %rax
+  push %rax
+  .loc 1 29
+  lea -240(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 29
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  lea -240(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..21(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 30
+  mov $4, %rax
+  push %rax
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  lea -228(%rbp), %rax
+  push %rax
+  .loc 1 30
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  mov $4, %rax
+  push %rax
+  .loc 1 30
+  lea -228(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 30
+  mov $4, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  mov $8, %rax
+  push %rax
+  .loc 1 30
+  lea -228(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 30
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  mov $4, %rax
+  push %rax
+  .loc 1 30
+  lea -228(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..22(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 31
+  mov $5, %rax
+  push %rax
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  lea -216(%rbp), %rax
+  push %rax
+  .loc 1 31
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  mov $4, %rax
+  push %rax
+  .loc 1 31
+  lea -216(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 31
+  mov $4, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  mov $8, %rax
+  push %rax
+  .loc 1 31
+  lea -216(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 31
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  mov $8, %rax
+  push %rax
+  .loc 1 31
+  lea -216(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..23(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 32
+  mov $5, %rax
+  push %rax
+  .loc 1 32
+  .loc 1 32
+  .loc 1 32
+  .loc 1 32
+  lea -204(%rbp), %rax
+  push %rax
+  .loc 1 32
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 32
+  .loc 1 32
+  .loc 1 32
+  .loc 1 32
+  mov $4, %rax
+  push %rax
+  .loc 1 32
+  lea -204(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 32
+  mov $4, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 32
+  .loc 1 32
+  .loc 1 32
+  .loc 1 32
+  mov $8, %rax
+  push %rax
+  .loc 1 32
+  lea -204(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 32
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 32
+  .loc 1 32
+  .loc 1 32
+  .loc 1 32
+  mov $8, %rax
+  push %rax
+  .loc 1 32
+  lea -204(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..24(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 34
+  mov $0, %rax
+  push %rax
+  .loc 1 34
+  .loc 1 34
+  .loc 1 34
+  .loc 1 34
+  lea -168(%rbp), %rax
+  push %rax
+  .loc 1 34
+  lea -192(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 34
+  .loc 1 34
+  .loc 1 34
+  lea -168(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  .loc 1 34
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 34
+  .loc 1 34
+  .loc 1 34
+  .loc 1 34
+  lea -192(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..25(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 35
+  mov $1, %rax
+  push %rax
+  .loc 1 35
+  .loc 1 35
+  .loc 1 35
+  .loc 1 35
+  lea -136(%rbp), %rax
+  push %rax
+  .loc 1 35
+  lea -160(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 35
+  .loc 1 35
+  .loc 1 35
+  .loc 1 35
+  mov $4, %rax
+  push %rax
+  .loc 1 35
+  lea -136(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 35
+  mov $1, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 35
+  .loc 1 35
+  .loc 1 35
+  .loc 1 35
+  mov $4, %rax
+  push %rax
+  .loc 1 35
+  .loc 1 35
+  lea -160(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..26(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 36
+  mov $2, %rax
+  push %rax
+  .loc 1 36
+  .loc 1 36
+  .loc 1 36
+  .loc 1 36
+  lea -104(%rbp), %rax
+  push %rax
+  .loc 1 36
+  lea -128(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 36
+  .loc 1 36
+  .loc 1 36
+  .loc 1 36
+  mov $8, %rax
+  push %rax
+  .loc 1 36
+  lea -104(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 36
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 36
+  .loc 1 36
+  .loc 1 36
+  .loc 1 36
+  mov $8, %rax
+  push %rax
+  .loc 1 36
+  .loc 1 36
+  lea -128(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..27(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 37
+  mov $3, %rax
+  push %rax
+  .loc 1 37
+  .loc 1 37
+  .loc 1 37
+  .loc 1 37
+  lea -72(%rbp), %rax
+  push %rax
+  .loc 1 37
+  lea -96(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 37
+  .loc 1 37
+  .loc 1 37
+  .loc 1 37
+  mov $12, %rax
+  push %rax
+  .loc 1 37
+  lea -72(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 37
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 37
+  .loc 1 37
+  .loc 1 37
+  .loc 1 37
+  .loc 1 37
+  mov $12, %rax
+  push %rax
+  .loc 1 37
+  lea -96(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..28(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 38
+  mov $4, %rax
+  push %rax
+  .loc 1 38
+  .loc 1 38
+  .loc 1 38
+  .loc 1 38
+  lea -40(%rbp), %rax
+  push %rax
+  .loc 1 38
+  lea -64(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 38
+  .loc 1 38
+  .loc 1 38
+  .loc 1 38
+  mov $16, %rax
+  push %rax
+  .loc 1 38
+  lea -40(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 38
+  mov $4, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 38
+  .loc 1 38
+  .loc 1 38
+  .loc 1 38
+  mov $4, %rax
+  push %rax
+  .loc 1 38
+  .loc 1 38
+  .loc 1 38
+  mov $12, %rax
+  push %rax
+  .loc 1 38
+  lea -64(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..29(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 39
+  mov $5, %rax
+  push %rax
+  .loc 1 39
+  .loc 1 39
+  .loc 1 39
+  .loc 1 39
+  lea -8(%rbp), %rax
+  push %rax
+  .loc 1 39
+  lea -32(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 39
+  .loc 1 39
+  .loc 1 39
+  .loc 1 39
+  mov $20, %rax
+  push %rax
+  .loc 1 39
+  lea -8(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 39
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 39
+  .loc 1 39
+  .loc 1 39
+  .loc 1 39
+  mov $8, %rax
+  push %rax
+  .loc 1 39
+  .loc 1 39
+  .loc 1 39
+  mov $12, %rax
+  push %rax
+  .loc 1 39
+  lea -32(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..30(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 41
+  .loc 1 41
+  .loc 1 41
+  lea .L..31(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+  .loc 1 42
+  .loc 1 42
+  mov $0, %rax
+  jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .data
+  .global .L..31
+.L..31:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .data
+  .global .L..30
+.L..30:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..29
+.L..29:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..28
+.L..28:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..27
+.L..27:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..26
+.L..26:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..25
+.L..25:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..24
+.L..24:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 50
+  .byte 91
+  .byte 120
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..23
+.L..23:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..22
+.L..22:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..21
+.L..21:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..20
+.L..20:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 53
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..19
+.L..19:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 52
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..18
+.L..18:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 51
+  .byte 41
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..17
+.L..17:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..16
+.L..16:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..15
+.L..15:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..14
+.L..14:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..13
+.L..13:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..12
+.L..12:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..11
+.L..11:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..10
+.L..10:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..9
+.L..9:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..8
+.L..8:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..7
+.L..7:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 50
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..6
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..5
+.L..5:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..4
+.L..4:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 45
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..3
+.L..3:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..2
+.L..2:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..1
+.L..1:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..0
+.L..0:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
@@ -0,0 +1,634 @@
+.file 1 "test/sizeof.c"
+.file 2 "test/test.h"
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+  .loc 2 1
+  .loc 2 1
+  .loc 2 1
+  .loc 1 4
+  mov $1, %rax
+  push %rax
+  .loc 1 4
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 5
+  mov $2, %rax
+  push %rax
+  .loc 1 5
+  mov $2, %rax
+  push %rax
+  .loc 2 1
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 6
+  mov $2, %rax
+  push %rax
+  .loc 1 6
+  mov $2, %rax
+  push %rax
+  .loc 2 1
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 7
+  mov $2, %rax
+  push %rax
+  .loc 1 7
+  mov $2, %rax
+  push %rax
+  .loc 2 1
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 8
+  mov $4, %rax
+  push %rax
+  .loc 1 8
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 9
+  mov $8, %rax
+  push %rax
+  .loc 1 9
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 10
+  mov $8, %rax
+  push %rax
+  .loc 1 10
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 11
+  mov $8, %rax
+  push %rax
+  .loc 1 11
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 12
+  mov $8, %rax
+  push %rax
+  .loc 1 12
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 13
+  mov $8, %rax
+  push %rax
+  .loc 1 13
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 14
+  mov $8, %rax
+  push %rax
+  .loc 1 14
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 15
+  mov $8, %rax
+  push %rax
+  .loc 1 15
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 16
+  mov $8, %rax
+  push %rax
+  .loc 1 16
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 17
+  mov $32, %rax
+  push %rax
+  .loc 1 17
+  mov $32, %rax
+  push %rax
+  .loc 2 1
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 18
+  mov $16, %rax
+  push %rax
+  .loc 1 18
+  mov $16, %rax
+  push %rax
+  .loc 2 1
+  lea .L..14(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 19
+  mov $48, %rax
+  push %rax
+  .loc 1 19
+  mov $48, %rax
+  push %rax
+  .loc 2 1
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 20
+  mov $8, %rax
+  push %rax
+  .loc 1 20
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..16(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 22
+  .loc 1 22
+  .loc 1 22
+  lea .L..17(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+  .loc 1 23
+  .loc 1 23
+  mov $0, %rax
+  jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .data
+  .global .L..17
+.L..17:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .data
+  .global .L..16
+.L..16:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..15
+.L..15:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+  .data
+  .global .L..14
+.L..14:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+  .data
+  .global .L..13
+.L..13:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 42
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+  .data
+  .global .L..12
+.L..12:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+  .data
+  .global .L..11
+.L..11:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 41
+  .byte 0
+  .data
+  .global .L..10
+.L..10:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+  .data
+  .global .L..9
+.L..9:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+  .data
+  .global .L..8
+.L..8:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+  .data
+  .global .L..7
+.L..7:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+  .data
+  .global .L..6
+.L..6:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+  .data
+  .global .L..5
+.L..5:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+  .data
+  .global .L..4
+.L..4:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+  .data
+  .global .L..3
+.L..3:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+  .data
+  .global .L..2
+.L..2:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+  .data
+  .global .L..1
+.L..1:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+  .data
+  .global .L..0
+.L..0:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
@@ -0,0 +1,1074 @@
+.file 1 "test/strings.c"
+.file 2 "test/test.h"
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $0, %rsp
+  .loc 2 1
+  .loc 2 1
+  .loc 2 1
+  .loc 1 4
+  mov $0, %rax
+  push %rax
+  .loc 1 4
+  .loc 1 4
+  lea .L..0(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 5
+  mov $1, %rax
+  push %rax
+  .loc 1 5
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 7
+  mov $97, %rax
+  push %rax
+  .loc 1 7
+  .loc 1 7
+  lea .L..4(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 8
+  mov $98, %rax
+  push %rax
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  mov $1, %rax
+  push %rax
+  .loc 1 8
+  lea .L..6(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 9
+  mov $99, %rax
+  push %rax
+  .loc 1 9
+  .loc 1 9
+  .loc 1 9
+  mov $2, %rax
+  push %rax
+  .loc 1 9
+  lea .L..8(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 10
+  mov $0, %rax
+  push %rax
+  .loc 1 10
+  .loc 1 10
+  .loc 1 10
+  mov $3, %rax
+  push %rax
+  .loc 1 10
+  lea .L..10(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 11
+  mov $4, %rax
+  push %rax
+  .loc 1 11
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 13
+  mov $7, %rax
+  push %rax
+  .loc 1 13
+  .loc 1 13
+  lea .L..14(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 14
+  mov $8, %rax
+  push %rax
+  .loc 1 14
+  .loc 1 14
+  lea .L..16(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..17(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 15
+  mov $9, %rax
+  push %rax
+  .loc 1 15
+  .loc 1 15
+  lea .L..18(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..19(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 16
+  mov $10, %rax
+  push %rax
+  .loc 1 16
+  .loc 1 16
+  lea .L..20(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..21(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 17
+  mov $11, %rax
+  push %rax
+  .loc 1 17
+  .loc 1 17
+  lea .L..22(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..23(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 18
+  mov $12, %rax
+  push %rax
+  .loc 1 18
+  .loc 1 18
+  lea .L..24(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..25(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 19
+  mov $13, %rax
+  push %rax
+  .loc 1 19
+  .loc 1 19
+  lea .L..26(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..27(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 20
+  mov $27, %rax
+  push %rax
+  .loc 1 20
+  .loc 1 20
+  lea .L..28(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..29(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 22
+  mov $106, %rax
+  push %rax
+  .loc 1 22
+  .loc 1 22
+  lea .L..30(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..31(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 23
+  mov $107, %rax
+  push %rax
+  .loc 1 23
+  .loc 1 23
+  lea .L..32(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..33(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 24
+  mov $108, %rax
+  push %rax
+  .loc 1 24
+  .loc 1 24
+  lea .L..34(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..35(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 26
+  mov $7, %rax
+  push %rax
+  .loc 1 26
+  .loc 1 26
+  lea .L..36(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..37(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 27
+  mov $120, %rax
+  push %rax
+  .loc 1 27
+  .loc 1 27
+  .loc 1 27
+  mov $1, %rax
+  push %rax
+  .loc 1 27
+  lea .L..38(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..39(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 28
+  mov $10, %rax
+  push %rax
+  .loc 1 28
+  .loc 1 28
+  .loc 1 28
+  mov $2, %rax
+  push %rax
+  .loc 1 28
+  lea .L..40(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..41(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 29
+  mov $121, %rax
+  push %rax
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  mov $3, %rax
+  push %rax
+  .loc 1 29
+  lea .L..42(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..43(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 31
+  mov $0, %rax
+  push %rax
+  .loc 1 31
+  .loc 1 31
+  lea .L..44(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..45(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 32
+  mov $16, %rax
+  push %rax
+  .loc 1 32
+  .loc 1 32
+  lea .L..46(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..47(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 33
+  mov $65, %rax
+  push %rax
+  .loc 1 33
+  .loc 1 33
+  lea .L..48(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..49(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 34
+  mov $104, %rax
+  push %rax
+  .loc 1 34
+  .loc 1 34
+  lea .L..50(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..51(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 35
+  mov $0, %rax
+  push %rax
+  .loc 1 35
+  .loc 1 35
+  lea .L..52(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..53(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 36
+  mov $119, %rax
+  push %rax
+  .loc 1 36
+  .loc 1 36
+  lea .L..54(%rip), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..55(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 38
+  .loc 1 38
+  .loc 1 38
+  lea .L..56(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+  .loc 1 39
+  .loc 1 39
+  mov $0, %rax
+  jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .data
+  .global .L..56
+.L..56:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .data
+  .global .L..55
+.L..55:
+  .byte 34
+  .byte 92
+  .byte 120
+  .byte 55
+  .byte 55
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..54
+.L..54:
+  .byte 119
+  .byte 0
+  .data
+  .global .L..53
+.L..53:
+  .byte 34
+  .byte 92
+  .byte 120
+  .byte 48
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..52
+.L..52:
+  .byte 0
+  .byte 0
+  .data
+  .global .L..51
+.L..51:
+  .byte 34
+  .byte 92
+  .byte 49
+  .byte 53
+  .byte 48
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..50
+.L..50:
+  .byte 104
+  .byte 48
+  .byte 0
+  .data
+  .global .L..49
+.L..49:
+  .byte 34
+  .byte 92
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..48
+.L..48:
+  .byte 65
+  .byte 0
+  .data
+  .global .L..47
+.L..47:
+  .byte 34
+  .byte 92
+  .byte 50
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..46
+.L..46:
+  .byte 16
+  .byte 0
+  .data
+  .global .L..45
+.L..45:
+  .byte 34
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..44
+.L..44:
+  .byte 0
+  .byte 0
+  .data
+  .global .L..43
+.L..43:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 120
+  .byte 92
+  .byte 110
+  .byte 121
+  .byte 34
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+  .data
+  .global .L..42
+.L..42:
+  .byte 7
+  .byte 120
+  .byte 10
+  .byte 121
+  .byte 0
+  .data
+  .global .L..41
+.L..41:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 120
+  .byte 92
+  .byte 110
+  .byte 121
+  .byte 34
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+  .data
+  .global .L..40
+.L..40:
+  .byte 7
+  .byte 120
+  .byte 10
+  .byte 121
+  .byte 0
+  .data
+  .global .L..39
+.L..39:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 120
+  .byte 92
+  .byte 110
+  .byte 121
+  .byte 34
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .data
+  .global .L..38
+.L..38:
+  .byte 7
+  .byte 120
+  .byte 10
+  .byte 121
+  .byte 0
+  .data
+  .global .L..37
+.L..37:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 120
+  .byte 92
+  .byte 110
+  .byte 121
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..36
+.L..36:
+  .byte 7
+  .byte 120
+  .byte 10
+  .byte 121
+  .byte 0
+  .data
+  .global .L..35
+.L..35:
+  .byte 34
+  .byte 92
+  .byte 108
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..34
+.L..34:
+  .byte 108
+  .byte 0
+  .data
+  .global .L..33
+.L..33:
+  .byte 34
+  .byte 92
+  .byte 107
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..32
+.L..32:
+  .byte 107
+  .byte 0
+  .data
+  .global .L..31
+.L..31:
+  .byte 34
+  .byte 92
+  .byte 106
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..30
+.L..30:
+  .byte 106
+  .byte 0
+  .data
+  .global .L..29
+.L..29:
+  .byte 34
+  .byte 92
+  .byte 101
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..28
+.L..28:
+  .byte 27
+  .byte 0
+  .data
+  .global .L..27
+.L..27:
+  .byte 34
+  .byte 92
+  .byte 114
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..26
+.L..26:
+  .byte 13
+  .byte 0
+  .data
+  .global .L..25
+.L..25:
+  .byte 34
+  .byte 92
+  .byte 102
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..24
+.L..24:
+  .byte 12
+  .byte 0
+  .data
+  .global .L..23
+.L..23:
+  .byte 34
+  .byte 92
+  .byte 118
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..22
+.L..22:
+  .byte 11
+  .byte 0
+  .data
+  .global .L..21
+.L..21:
+  .byte 34
+  .byte 92
+  .byte 110
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..20
+.L..20:
+  .byte 10
+  .byte 0
+  .data
+  .global .L..19
+.L..19:
+  .byte 34
+  .byte 92
+  .byte 116
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..18
+.L..18:
+  .byte 9
+  .byte 0
+  .data
+  .global .L..17
+.L..17:
+  .byte 34
+  .byte 92
+  .byte 98
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..16
+.L..16:
+  .byte 8
+  .byte 0
+  .data
+  .global .L..15
+.L..15:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..14
+.L..14:
+  .byte 7
+  .byte 0
+  .data
+  .global .L..13
+.L..13:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 41
+  .byte 0
+  .data
+  .global .L..12
+.L..12:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .data
+  .global .L..11
+.L..11:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+  .data
+  .global .L..10
+.L..10:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .data
+  .global .L..9
+.L..9:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+  .data
+  .global .L..8
+.L..8:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .data
+  .global .L..7
+.L..7:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .data
+  .global .L..6
+.L..6:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .data
+  .global .L..5
+.L..5:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..4
+.L..4:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .data
+  .global .L..3
+.L..3:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 34
+  .byte 34
+  .byte 41
+  .byte 0
+  .data
+  .global .L..2
+.L..2:
+  .byte 0
+  .data
+  .global .L..1
+.L..1:
+  .byte 34
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .data
+  .global .L..0
+.L..0:
+  .byte 0
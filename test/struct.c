@@ -47,6 +47,9 @@ int main() {
     ASSERT(16, ({ struct {char a; long b;} x; sizeof(x); }));
     ASSERT(4, ({ struct {char a; short b;} x; sizeof(x); }));
 
+    ASSERT(7, ({ struct {int a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,b0,b1,b2,b3,b4,b5,b6,b7,b8,b9;} x; x.b9=7; x.a0=1; x.b9; }));
+    ASSERT(19, ({ struct {int a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,b0,b1,b2,b3,b4,b5,b6,b7,b8,b9;} x; &x.b9 - &x.a0; }));
+
     printf("OK\n");
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,3594 @@
+.file 1 "test/struct.c"
+.file 2 "test/test.h"
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $608, %rsp
+  .loc 2 1
+  .loc 2 1
+  .loc 2 1
+  .loc 1 4
+  mov $1, %rax
+  push %rax
+  .loc 1 4
+  .loc 1 4
+  .loc 1 4
+  lea -596(%rbp), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 4
+  mov $1, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 4
+  .loc 1 4
+  lea -596(%rbp), %rax
+  add $4, %rax
+  push %rax
+  .loc 1 4
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 4
+  .loc 1 4
+  lea -596(%rbp), %rax
+  add $0, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 5
+  mov $2, %rax
+  push %rax
+  .loc 1 5
+  .loc 1 5
+  .loc 1 5
+  lea -588(%rbp), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 5
+  mov $1, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 5
+  .loc 1 5
+  lea -588(%rbp), %rax
+  add $4, %rax
+  push %rax
+  .loc 1 5
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 5
+  .loc 1 5
+  lea -588(%rbp), %rax
+  add $4, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 6
+  mov $1, %rax
+  push %rax
+  .loc 1 6
+  .loc 1 6
+  .loc 1 6
+  lea -580(%rbp), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 6
+  mov $1, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 6
+  .loc 1 6
+  lea -580(%rbp), %rax
+  add $4, %rax
+  push %rax
+  .loc 1 6
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 6
+  .loc 1 6
+  lea -580(%rbp), %rax
+  add $8, %rax
+  push %rax
+  .loc 1 6
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 6
+  .loc 1 6
+  lea -580(%rbp), %rax
+  add $0, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 7
+  mov $2, %rax
+  push %rax
+  .loc 1 7
+  .loc 1 7
+  .loc 1 7
+  lea -568(%rbp), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 7
+  mov $1, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 7
+  .loc 1 7
+  lea -568(%rbp), %rax
+  add $4, %rax
+  push %rax
+  .loc 1 7
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 7
+  .loc 1 7
+  lea -568(%rbp), %rax
+  add $8, %rax
+  push %rax
+  .loc 1 7
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 7
+  .loc 1 7
+  lea -568(%rbp), %rax
+  add $4, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 8
+  mov $3, %rax
+  push %rax
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  lea -556(%rbp), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 8
+  mov $1, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 8
+  .loc 1 8
+  lea -556(%rbp), %rax
+  add $4, %rax
+  push %rax
+  .loc 1 8
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 8
+  .loc 1 8
+  lea -556(%rbp), %rax
+  add $8, %rax
+  push %rax
+  .loc 1 8
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 8
+  .loc 1 8
+  lea -556(%rbp), %rax
+  add $8, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 10
+  mov $0, %rax
+  push %rax
+  .loc 1 10
+  .loc 1 10
+  .loc 1 10
+  .loc 1 10
+  lea -536(%rbp), %rax
+  push %rax
+  .loc 1 10
+  lea -542(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 10
+  .loc 1 10
+  .loc 1 10
+  lea -536(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  .loc 1 10
+  mov $0, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 10
+  .loc 1 10
+  .loc 1 10
+  lea -542(%rbp), %rax
+  add $0, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 11
+  mov $1, %rax
+  push %rax
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  lea -520(%rbp), %rax
+  push %rax
+  .loc 1 11
+  lea -526(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  mov $1, %rax
+  push %rax
+  .loc 1 11
+  lea -520(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 11
+  mov $1, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  lea -526(%rbp), %rax
+  add $1, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 12
+  mov $2, %rax
+  push %rax
+  .loc 1 12
+  .loc 1 12
+  .loc 1 12
+  .loc 1 12
+  lea -504(%rbp), %rax
+  push %rax
+  .loc 1 12
+  lea -510(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 12
+  .loc 1 12
+  .loc 1 12
+  .loc 1 12
+  mov $2, %rax
+  push %rax
+  .loc 1 12
+  lea -504(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 12
+  mov $2, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 12
+  .loc 1 12
+  .loc 1 12
+  .loc 1 12
+  mov $2, %rax
+  push %rax
+  .loc 1 12
+  lea -510(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  add $0, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 13
+  mov $3, %rax
+  push %rax
+  .loc 1 13
+  .loc 1 13
+  .loc 1 13
+  .loc 1 13
+  lea -488(%rbp), %rax
+  push %rax
+  .loc 1 13
+  lea -494(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 13
+  .loc 1 13
+  .loc 1 13
+  .loc 1 13
+  mov $3, %rax
+  push %rax
+  .loc 1 13
+  lea -488(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 13
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 13
+  .loc 1 13
+  .loc 1 13
+  .loc 1 13
+  mov $2, %rax
+  push %rax
+  .loc 1 13
+  lea -494(%rbp), %rax
+  pop %rdi
+  add %rdi, %rax
+  add $1, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 15
+  mov $6, %rax
+  push %rax
+  .loc 1 15
+  .loc 1 15
+  .loc 1 15
+  .loc 1 15
+  lea -472(%rbp), %rax
+  push %rax
+  .loc 1 15
+  lea -480(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 15
+  .loc 1 15
+  .loc 1 15
+  lea -480(%rbp), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 15
+  mov $6, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 15
+  .loc 1 15
+  .loc 1 15
+  lea -472(%rbp), %rax
+  mov (%rax), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 16
+  mov $7, %rax
+  push %rax
+  .loc 1 16
+  .loc 1 16
+  .loc 1 16
+  .loc 1 16
+  lea -456(%rbp), %rax
+  push %rax
+  .loc 1 16
+  lea -464(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 16
+  .loc 1 16
+  .loc 1 16
+  lea -464(%rbp), %rax
+  add $3, %rax
+  push %rax
+  .loc 1 16
+  mov $7, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 16
+  .loc 1 16
+  .loc 1 16
+  .loc 1 16
+  mov $3, %rax
+  push %rax
+  .loc 1 16
+  lea -456(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 18
+  mov $6, %rax
+  push %rax
+  .loc 1 18
+  .loc 1 18
+  .loc 1 18
+  lea -445(%rbp), %rax
+  add $0, %rax
+  add $0, %rax
+  push %rax
+  .loc 1 18
+  mov $6, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 18
+  .loc 1 18
+  lea -445(%rbp), %rax
+  add $0, %rax
+  add $0, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 20
+  mov $4, %rax
+  push %rax
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 21
+  mov $8, %rax
+  push %rax
+  .loc 1 21
+  .loc 1 21
+  .loc 1 21
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 22
+  mov $8, %rax
+  push %rax
+  .loc 1 22
+  .loc 1 22
+  .loc 1 22
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..14(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 23
+  mov $12, %rax
+  push %rax
+  .loc 1 23
+  .loc 1 23
+  .loc 1 23
+  mov $12, %rax
+  push %rax
+  .loc 2 1
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 24
+  mov $16, %rax
+  push %rax
+  .loc 1 24
+  .loc 1 24
+  .loc 1 24
+  mov $16, %rax
+  push %rax
+  .loc 2 1
+  lea .L..16(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 25
+  mov $24, %rax
+  push %rax
+  .loc 1 25
+  .loc 1 25
+  .loc 1 25
+  mov $24, %rax
+  push %rax
+  .loc 2 1
+  lea .L..17(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 26
+  mov $2, %rax
+  push %rax
+  .loc 1 26
+  .loc 1 26
+  .loc 1 26
+  mov $2, %rax
+  push %rax
+  .loc 2 1
+  lea .L..18(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 27
+  mov $0, %rax
+  push %rax
+  .loc 1 27
+  .loc 1 27
+  .loc 1 27
+  mov $0, %rax
+  push %rax
+  .loc 2 1
+  lea .L..19(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 28
+  mov $8, %rax
+  push %rax
+  .loc 1 28
+  .loc 1 28
+  .loc 1 28
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..20(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 29
+  mov $8, %rax
+  push %rax
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..21(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 31
+  mov $8, %rax
+  push %rax
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..22(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 32
+  mov $8, %rax
+  push %rax
+  .loc 1 32
+  .loc 1 32
+  .loc 1 32
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..23(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 33
+  mov $2, %rax
+  push %rax
+  .loc 1 33
+  .loc 1 33
+  .loc 1 33
+  mov $2, %rax
+  push %rax
+  .loc 2 1
+  lea .L..24(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 34
+  mov $3, %rax
+  push %rax
+  .loc 1 34
+  .loc 1 34
+  .loc 1 34
+  .loc 1 34
+  lea -324(%rbp), %rax
+  push %rax
+  .loc 1 34
+  mov $1, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 34
+  .loc 1 34
+  lea -320(%rbp), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 34
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 34
+  .loc 1 34
+  .loc 1 34
+  lea -320(%rbp), %rax
+  add $0, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 34
+  lea -324(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 2 1
+  lea .L..25(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 36
+  mov $3, %rax
+  push %rax
+  .loc 1 36
+  .loc 1 36
+  .loc 1 36
+  .loc 1 36
+  lea -312(%rbp), %rax
+  push %rax
+  .loc 1 36
+  lea -313(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 36
+  .loc 1 36
+  lea -313(%rbp), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 36
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 36
+  .loc 1 36
+  .loc 1 36
+  lea -312(%rbp), %rax
+  mov (%rax), %rax
+  add $0, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..26(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 37
+  mov $3, %rax
+  push %rax
+  .loc 1 37
+  .loc 1 37
+  .loc 1 37
+  .loc 1 37
+  lea -296(%rbp), %rax
+  push %rax
+  .loc 1 37
+  lea -297(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 37
+  .loc 1 37
+  .loc 1 37
+  lea -296(%rbp), %rax
+  mov (%rax), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 37
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 37
+  .loc 1 37
+  lea -297(%rbp), %rax
+  add $0, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..27(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 39
+  mov $3, %rax
+  push %rax
+  .loc 1 39
+  .loc 1 39
+  .loc 1 39
+  lea -288(%rbp), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 39
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 39
+  .loc 1 39
+  lea -280(%rbp), %rax
+  push %rax
+  .loc 1 39
+  lea -288(%rbp), %rax
+  pop %rdi
+  mov 0(%rax), %r8b
+  mov %r8b, 0(%rdi)
+  mov 1(%rax), %r8b
+  mov %r8b, 1(%rdi)
+  mov 2(%rax), %r8b
+  mov %r8b, 2(%rdi)
+  mov 3(%rax), %r8b
+  mov %r8b, 3(%rdi)
+  mov 4(%rax), %r8b
+  mov %r8b, 4(%rdi)
+  mov 5(%rax), %r8b
+  mov %r8b, 5(%rdi)
+  mov 6(%rax), %r8b
+  mov %r8b, 6(%rdi)
+  mov 7(%rax), %r8b
+  mov %r8b, 7(%rdi)
+  .loc 1 39
+  .loc 1 39
+  lea -280(%rbp), %rax
+  add $0, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..28(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 40
+  mov $7, %rax
+  push %rax
+  .loc 1 40
+  .loc 1 40
+  .loc 1 40
+  lea -272(%rbp), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 40
+  mov $7, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 40
+  .loc 1 40
+  .loc 1 40
+  lea -256(%rbp), %rax
+  push %rax
+  .loc 1 40
+  lea -264(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 40
+  .loc 1 40
+  .loc 1 40
+  lea -256(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  .loc 1 40
+  lea -272(%rbp), %rax
+  pop %rdi
+  mov 0(%rax), %r8b
+  mov %r8b, 0(%rdi)
+  mov 1(%rax), %r8b
+  mov %r8b, 1(%rdi)
+  mov 2(%rax), %r8b
+  mov %r8b, 2(%rdi)
+  mov 3(%rax), %r8b
+  mov %r8b, 3(%rdi)
+  mov 4(%rax), %r8b
+  mov %r8b, 4(%rdi)
+  mov 5(%rax), %r8b
+  mov %r8b, 5(%rdi)
+  mov 6(%rax), %r8b
+  mov %r8b, 6(%rdi)
+  mov 7(%rax), %r8b
+  mov %r8b, 7(%rdi)
+  .loc 1 40
+  .loc 1 40
+  lea -264(%rbp), %rax
+  add $0, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..29(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 41
+  mov $7, %rax
+  push %rax
+  .loc 1 41
+  .loc 1 41
+  .loc 1 41
+  lea -248(%rbp), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 41
+  mov $7, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 41
+  .loc 1 41
+  .loc 1 41
+  lea -232(%rbp), %rax
+  push %rax
+  .loc 1 41
+  lea -248(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 41
+  .loc 1 41
+  lea -224(%rbp), %rax
+  push %rax
+  .loc 1 41
+  lea -240(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 41
+  .loc 1 41
+  .loc 1 41
+  lea -224(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  .loc 1 41
+  .loc 1 41
+  lea -232(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  mov 0(%rax), %r8b
+  mov %r8b, 0(%rdi)
+  mov 1(%rax), %r8b
+  mov %r8b, 1(%rdi)
+  mov 2(%rax), %r8b
+  mov %r8b, 2(%rdi)
+  mov 3(%rax), %r8b
+  mov %r8b, 3(%rdi)
+  mov 4(%rax), %r8b
+  mov %r8b, 4(%rdi)
+  mov 5(%rax), %r8b
+  mov %r8b, 5(%rdi)
+  mov 6(%rax), %r8b
+  mov %r8b, 6(%rdi)
+  mov 7(%rax), %r8b
+  mov %r8b, 7(%rdi)
+  .loc 1 41
+  .loc 1 41
+  lea -240(%rbp), %rax
+  add $0, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..30(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 42
+  mov $5, %rax
+  push %rax
+  .loc 1 42
+  .loc 1 42
+  .loc 1 42
+  lea -212(%rbp), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 42
+  mov $5, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 42
+  .loc 1 42
+  lea -210(%rbp), %rax
+  push %rax
+  .loc 1 42
+  lea -212(%rbp), %rax
+  pop %rdi
+  mov 0(%rax), %r8b
+  mov %r8b, 0(%rdi)
+  mov 1(%rax), %r8b
+  mov %r8b, 1(%rdi)
+  .loc 1 42
+  .loc 1 42
+  lea -210(%rbp), %rax
+  add $0, %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..31(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 44
+  mov $8, %rax
+  push %rax
+  .loc 1 44
+  .loc 1 44
+  .loc 1 44
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..32(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 45
+  mov $8, %rax
+  push %rax
+  .loc 1 45
+  .loc 1 45
+  .loc 1 45
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..33(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 47
+  mov $16, %rax
+  push %rax
+  .loc 1 47
+  .loc 1 47
+  .loc 1 47
+  mov $16, %rax
+  push %rax
+  .loc 2 1
+  lea .L..34(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 48
+  mov $4, %rax
+  push %rax
+  .loc 1 48
+  .loc 1 48
+  .loc 1 48
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..35(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 50
+  mov $7, %rax
+  push %rax
+  .loc 1 50
+  .loc 1 50
+  .loc 1 50
+  lea -160(%rbp), %rax
+  add $76, %rax
+  push %rax
+  .loc 1 50
+  mov $7, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 50
+  .loc 1 50
+  lea -160(%rbp), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 50
+  mov $1, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 50
+  .loc 1 50
+  lea -160(%rbp), %rax
+  add $76, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..36(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 51
+  mov $19, %rax
+  push %rax
+  .loc 1 51
+  .loc 1 51
+  .loc 1 51
+  .loc 1 51
+  mov $4, %rax
+  push %rax
+  .loc 1 51
+  .loc 1 51
+  lea -80(%rbp), %rax
+  add $0, %rax
+  push %rax
+  .loc 1 51
+  lea -80(%rbp), %rax
+  add $76, %rax
+  pop %rdi
+  sub %rdi, %rax
+  pop %rdi
+  cqo
+  idiv %rdi
+  push %rax
+  .loc 2 1
+  lea .L..37(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 53
+  .loc 1 53
+  .loc 1 53
+  lea .L..38(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+  .loc 1 54
+  .loc 1 54
+  mov $0, %rax
+  jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .data
+  .global .L..38
+.L..38:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .data
+  .global .L..37
+.L..37:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 48
+  .byte 44
+  .byte 97
+  .byte 49
+  .byte 44
+  .byte 97
+  .byte 50
+  .byte 44
+  .byte 97
+  .byte 51
+  .byte 44
+  .byte 97
+  .byte 52
+  .byte 44
+  .byte 97
+  .byte 53
+  .byte 44
+  .byte 97
+  .byte 54
+  .byte 44
+  .byte 97
+  .byte 55
+  .byte 44
+  .byte 97
+  .byte 56
+  .byte 44
+  .byte 97
+  .byte 57
+  .byte 44
+  .byte 98
+  .byte 48
+  .byte 44
+  .byte 98
+  .byte 49
+  .byte 44
+  .byte 98
+  .byte 50
+  .byte 44
+  .byte 98
+  .byte 51
+  .byte 44
+  .byte 98
+  .byte 52
+  .byte 44
+  .byte 98
+  .byte 53
+  .byte 44
+  .byte 98
+  .byte 54
+  .byte 44
+  .byte 98
+  .byte 55
+  .byte 44
+  .byte 98
+  .byte 56
+  .byte 44
+  .byte 98
+  .byte 57
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 57
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..36
+.L..36:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 48
+  .byte 44
+  .byte 97
+  .byte 49
+  .byte 44
+  .byte 97
+  .byte 50
+  .byte 44
+  .byte 97
+  .byte 51
+  .byte 44
+  .byte 97
+  .byte 52
+  .byte 44
+  .byte 97
+  .byte 53
+  .byte 44
+  .byte 97
+  .byte 54
+  .byte 44
+  .byte 97
+  .byte 55
+  .byte 44
+  .byte 97
+  .byte 56
+  .byte 44
+  .byte 97
+  .byte 57
+  .byte 44
+  .byte 98
+  .byte 48
+  .byte 44
+  .byte 98
+  .byte 49
+  .byte 44
+  .byte 98
+  .byte 50
+  .byte 44
+  .byte 98
+  .byte 51
+  .byte 44
+  .byte 98
+  .byte 52
+  .byte 44
+  .byte 98
+  .byte 53
+  .byte 44
+  .byte 98
+  .byte 54
+  .byte 44
+  .byte 98
+  .byte 55
+  .byte 44
+  .byte 98
+  .byte 56
+  .byte 44
+  .byte 98
+  .byte 57
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 57
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 48
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..35
+.L..35:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..34
+.L..34:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..33
+.L..33:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..32
+.L..32:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..31
+.L..31:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..30
+.L..30:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 44
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 42
+  .byte 113
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 113
+  .byte 61
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..29
+.L..29:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..28
+.L..28:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..27
+.L..27:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..26
+.L..26:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..25
+.L..25:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 116
+  .byte 43
+  .byte 121
+  .byte 46
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..24
+.L..24:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..23
+.L..23:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..22
+.L..22:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..21
+.L..21:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..20
+.L..20:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..19
+.L..19:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..18
+.L..18:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..17
+.L..17:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..16
+.L..16:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..15
+.L..15:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..14
+.L..14:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..13
+.L..13:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..12
+.L..12:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..11
+.L..11:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..10
+.L..10:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..9
+.L..9:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..8
+.L..8:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..7
+.L..7:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..6
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..5
+.L..5:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..4
+.L..4:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..3
+.L..3:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..2
+.L..2:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..1
+.L..1:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..0
+.L..0:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
@@ -42,6 +42,7 @@ int main() {
 
     ASSERT(2, ({ int x=2; { int x=3; } x; }));
     ASSERT(2, ({ int x=2; { int x=3; } int y=4; x; }));
+    ASSERT(1, ({ int x=1; { int x=2; { int x=3; } { int y=x; } } x; }));
     ASSERT(3, ({ int x=2; { x=3; } x; }));
 
     ASSERT(7, ({ int x; int y; char z; char *a=&y; char *b=&z; b-a; }));
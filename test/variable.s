@@ -0,0 +1,3152 @@
+.file 1 "test/variable.c"
+.file 2 "test/test.h"
+  .globl main
+  .text
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $624, %rsp
+  .loc 2 1
+  .loc 2 1
+  .loc 2 1
+  .loc 1 6
+  mov $3, %rax
+  push %rax
+  .loc 1 6
+  .loc 1 6
+  .loc 1 6
+  lea -612(%rbp), %rax
+  push %rax
+  .loc 1 6
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 6
+  .loc 1 6
+  lea -612(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..0(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 7
+  mov $3, %rax
+  push %rax
+  .loc 1 7
+  .loc 1 7
+  .loc 1 7
+  .loc 1 7
+  lea -608(%rbp), %rax
+  push %rax
+  .loc 1 7
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 7
+  .loc 1 7
+  lea -608(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..1(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 8
+  mov $8, %rax
+  push %rax
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  lea -604(%rbp), %rax
+  push %rax
+  .loc 1 8
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  lea -600(%rbp), %rax
+  push %rax
+  .loc 1 8
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 8
+  .loc 1 8
+  .loc 1 8
+  lea -600(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 8
+  lea -604(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 2 1
+  lea .L..2(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 9
+  mov $6, %rax
+  push %rax
+  .loc 1 9
+  .loc 1 9
+  .loc 1 9
+  lea -596(%rbp), %rax
+  push %rax
+  .loc 1 9
+  lea -592(%rbp), %rax
+  push %rax
+  .loc 1 9
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 9
+  .loc 1 9
+  .loc 1 9
+  lea -592(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 9
+  lea -596(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 2 1
+  lea .L..3(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 10
+  mov $3, %rax
+  push %rax
+  .loc 1 10
+  .loc 1 10
+  .loc 1 10
+  .loc 1 10
+  lea -588(%rbp), %rax
+  push %rax
+  .loc 1 10
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 10
+  .loc 1 10
+  lea -588(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..4(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 11
+  mov $8, %rax
+  push %rax
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  lea -584(%rbp), %rax
+  push %rax
+  .loc 1 11
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  lea -580(%rbp), %rax
+  push %rax
+  .loc 1 11
+  mov $5, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 11
+  .loc 1 11
+  .loc 1 11
+  lea -580(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 1 11
+  lea -584(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 2 1
+  lea .L..5(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 13
+  mov $4, %rax
+  push %rax
+  .loc 1 13
+  .loc 1 13
+  .loc 1 13
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..6(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 14
+  mov $4, %rax
+  push %rax
+  .loc 1 14
+  .loc 1 14
+  .loc 1 14
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 15
+  mov $8, %rax
+  push %rax
+  .loc 1 15
+  .loc 1 15
+  .loc 1 15
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..8(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 16
+  mov $16, %rax
+  push %rax
+  .loc 1 16
+  .loc 1 16
+  .loc 1 16
+  mov $16, %rax
+  push %rax
+  .loc 2 1
+  lea .L..9(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 17
+  mov $48, %rax
+  push %rax
+  .loc 1 17
+  .loc 1 17
+  .loc 1 17
+  mov $48, %rax
+  push %rax
+  .loc 2 1
+  lea .L..10(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 18
+  mov $16, %rax
+  push %rax
+  .loc 1 18
+  .loc 1 18
+  .loc 1 18
+  mov $16, %rax
+  push %rax
+  .loc 2 1
+  lea .L..11(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 19
+  mov $4, %rax
+  push %rax
+  .loc 1 19
+  .loc 1 19
+  .loc 1 19
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..12(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 20
+  mov $5, %rax
+  push %rax
+  .loc 1 20
+  .loc 1 20
+  .loc 1 20
+  mov $5, %rax
+  push %rax
+  .loc 2 1
+  lea .L..13(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 21
+  mov $5, %rax
+  push %rax
+  .loc 1 21
+  .loc 1 21
+  .loc 1 21
+  mov $5, %rax
+  push %rax
+  .loc 2 1
+  lea .L..14(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 22
+  mov $4, %rax
+  push %rax
+  .loc 1 22
+  .loc 1 22
+  .loc 1 22
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..15(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 23
+  mov $4, %rax
+  push %rax
+  .loc 1 23
+  .loc 1 23
+  .loc 1 23
+  .loc 1 23
+  lea -252(%rbp), %rax
+  push %rax
+  .loc 1 23
+  mov $1, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 23
+  .loc 1 23
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..16(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 24
+  mov $1, %rax
+  push %rax
+  .loc 1 24
+  .loc 1 24
+  .loc 1 24
+  .loc 1 24
+  lea -248(%rbp), %rax
+  push %rax
+  .loc 1 24
+  mov $1, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 24
+  .loc 1 24
+  mov $4, %rax
+  .loc 1 24
+  .loc 1 24
+  lea -248(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..17(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 26
+  mov $0, %rax
+  push %rax
+  .loc 1 26
+  lea g1(%rip), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..18(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 27
+  mov $3, %rax
+  push %rax
+  .loc 1 27
+  .loc 1 27
+  .loc 1 27
+  lea g1(%rip), %rax
+  push %rax
+  .loc 1 27
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 27
+  .loc 1 27
+  lea g1(%rip), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..19(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 28
+  mov $0, %rax
+  push %rax
+  .loc 1 28
+  .loc 1 28
+  .loc 1 28
+  .loc 1 28
+  lea g2(%rip), %rax
+  push %rax
+  .loc 1 28
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 28
+  .loc 1 28
+  .loc 1 28
+  .loc 1 28
+  mov $4, %rax
+  push %rax
+  .loc 1 28
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 28
+  mov $1, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 28
+  .loc 1 28
+  .loc 1 28
+  .loc 1 28
+  mov $8, %rax
+  push %rax
+  .loc 1 28
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 28
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 28
+  .loc 1 28
+  .loc 1 28
+  .loc 1 28
+  mov $12, %rax
+  push %rax
+  .loc 1 28
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 28
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 28
+  .loc 1 28
+  .loc 1 28
+  lea g2(%rip), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..20(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 29
+  mov $1, %rax
+  push %rax
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  lea g2(%rip), %rax
+  push %rax
+  .loc 1 29
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  mov $4, %rax
+  push %rax
+  .loc 1 29
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 29
+  mov $1, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  mov $8, %rax
+  push %rax
+  .loc 1 29
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 29
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  mov $12, %rax
+  push %rax
+  .loc 1 29
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 29
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  .loc 1 29
+  mov $4, %rax
+  push %rax
+  .loc 1 29
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..21(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 30
+  mov $2, %rax
+  push %rax
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  lea g2(%rip), %rax
+  push %rax
+  .loc 1 30
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  mov $4, %rax
+  push %rax
+  .loc 1 30
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 30
+  mov $1, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  mov $8, %rax
+  push %rax
+  .loc 1 30
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 30
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  mov $12, %rax
+  push %rax
+  .loc 1 30
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 30
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  .loc 1 30
+  mov $8, %rax
+  push %rax
+  .loc 1 30
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..22(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 31
+  mov $3, %rax
+  push %rax
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  lea g2(%rip), %rax
+  push %rax
+  .loc 1 31
+  mov $0, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  mov $4, %rax
+  push %rax
+  .loc 1 31
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 31
+  mov $1, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  mov $8, %rax
+  push %rax
+  .loc 1 31
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 31
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  mov $12, %rax
+  push %rax
+  .loc 1 31
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  .loc 1 31
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  .loc 1 31
+  mov $12, %rax
+  push %rax
+  .loc 1 31
+  lea g2(%rip), %rax
+  pop %rdi
+  add %rdi, %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..23(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 33
+  mov $4, %rax
+  push %rax
+  .loc 1 33
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..24(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 34
+  mov $16, %rax
+  push %rax
+  .loc 1 34
+  mov $16, %rax
+  push %rax
+  .loc 2 1
+  lea .L..25(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 36
+  mov $1, %rax
+  push %rax
+  .loc 1 36
+  .loc 1 36
+  .loc 1 36
+  .loc 1 36
+  lea -244(%rbp), %rax
+  push %rax
+  .loc 1 36
+  mov $1, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 36
+  .loc 1 36
+  lea -244(%rbp), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..26(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 37
+  mov $1, %rax
+  push %rax
+  .loc 1 37
+  .loc 1 37
+  .loc 1 37
+  .loc 1 37
+  lea -243(%rbp), %rax
+  push %rax
+  .loc 1 37
+  mov $1, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 37
+  .loc 1 37
+  .loc 1 37
+  lea -242(%rbp), %rax
+  push %rax
+  .loc 1 37
+  mov $2, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 37
+  .loc 1 37
+  lea -243(%rbp), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..27(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 38
+  mov $2, %rax
+  push %rax
+  .loc 1 38
+  .loc 1 38
+  .loc 1 38
+  .loc 1 38
+  lea -241(%rbp), %rax
+  push %rax
+  .loc 1 38
+  mov $1, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 38
+  .loc 1 38
+  .loc 1 38
+  lea -240(%rbp), %rax
+  push %rax
+  .loc 1 38
+  mov $2, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 38
+  .loc 1 38
+  lea -240(%rbp), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..28(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 40
+  mov $1, %rax
+  push %rax
+  .loc 1 40
+  .loc 1 40
+  .loc 1 40
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..29(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 41
+  mov $10, %rax
+  push %rax
+  .loc 1 41
+  .loc 1 41
+  .loc 1 41
+  mov $10, %rax
+  push %rax
+  .loc 2 1
+  lea .L..30(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 43
+  mov $2, %rax
+  push %rax
+  .loc 1 43
+  .loc 1 43
+  .loc 1 43
+  .loc 1 43
+  lea -228(%rbp), %rax
+  push %rax
+  .loc 1 43
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 43
+  .loc 1 43
+  .loc 1 43
+  .loc 1 43
+  lea -224(%rbp), %rax
+  push %rax
+  .loc 1 43
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 43
+  .loc 1 43
+  lea -228(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..31(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 44
+  mov $2, %rax
+  push %rax
+  .loc 1 44
+  .loc 1 44
+  .loc 1 44
+  .loc 1 44
+  lea -220(%rbp), %rax
+  push %rax
+  .loc 1 44
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 44
+  .loc 1 44
+  .loc 1 44
+  .loc 1 44
+  lea -216(%rbp), %rax
+  push %rax
+  .loc 1 44
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 44
+  .loc 1 44
+  .loc 1 44
+  lea -212(%rbp), %rax
+  push %rax
+  .loc 1 44
+  mov $4, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 44
+  .loc 1 44
+  lea -220(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..32(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 45
+  mov $1, %rax
+  push %rax
+  .loc 1 45
+  .loc 1 45
+  .loc 1 45
+  .loc 1 45
+  lea -208(%rbp), %rax
+  push %rax
+  .loc 1 45
+  mov $1, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 45
+  .loc 1 45
+  .loc 1 45
+  .loc 1 45
+  lea -204(%rbp), %rax
+  push %rax
+  .loc 1 45
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 45
+  .loc 1 45
+  .loc 1 45
+  .loc 1 45
+  lea -200(%rbp), %rax
+  push %rax
+  .loc 1 45
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 45
+  .loc 1 45
+  .loc 1 45
+  .loc 1 45
+  lea -196(%rbp), %rax
+  push %rax
+  .loc 1 45
+  lea -204(%rbp), %rax
+  movsxd (%rax), %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 45
+  .loc 1 45
+  lea -208(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..33(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 46
+  mov $3, %rax
+  push %rax
+  .loc 1 46
+  .loc 1 46
+  .loc 1 46
+  .loc 1 46
+  lea -192(%rbp), %rax
+  push %rax
+  .loc 1 46
+  mov $2, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 46
+  .loc 1 46
+  .loc 1 46
+  lea -192(%rbp), %rax
+  push %rax
+  .loc 1 46
+  mov $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  .loc 1 46
+  .loc 1 46
+  lea -192(%rbp), %rax
+  movsxd (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..34(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 48
+  mov $7, %rax
+  push %rax
+  .loc 1 48
+  .loc 1 48
+  .loc 1 48
+  .loc 1 48
+  lea -176(%rbp), %rax
+  push %rax
+  .loc 1 48
+  lea -184(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 48
+  .loc 1 48
+  .loc 1 48
+  lea -168(%rbp), %rax
+  push %rax
+  .loc 1 48
+  lea -177(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 48
+  .loc 1 48
+  .loc 1 48
+  lea -176(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  .loc 1 48
+  lea -168(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  sub %rdi, %rax
+  push %rax
+  .loc 2 1
+  lea .L..35(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 49
+  mov $1, %rax
+  push %rax
+  .loc 1 49
+  .loc 1 49
+  .loc 1 49
+  .loc 1 49
+  lea -144(%rbp), %rax
+  push %rax
+  .loc 1 49
+  lea -149(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 49
+  .loc 1 49
+  .loc 1 49
+  lea -136(%rbp), %rax
+  push %rax
+  .loc 1 49
+  lea -148(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 49
+  .loc 1 49
+  .loc 1 49
+  lea -144(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  .loc 1 49
+  lea -136(%rbp), %rax
+  mov (%rax), %rax
+  pop %rdi
+  sub %rdi, %rax
+  push %rax
+  .loc 2 1
+  lea .L..36(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 51
+  mov $8, %rax
+  push %rax
+  .loc 1 51
+  .loc 1 51
+  .loc 1 51
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..37(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 52
+  mov $2, %rax
+  push %rax
+  .loc 1 52
+  .loc 1 52
+  .loc 1 52
+  mov $2, %rax
+  push %rax
+  .loc 2 1
+  lea .L..38(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 54
+  mov $24, %rax
+  push %rax
+  .loc 1 54
+  .loc 1 54
+  .loc 1 54
+  mov $24, %rax
+  push %rax
+  .loc 2 1
+  lea .L..39(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 55
+  mov $8, %rax
+  push %rax
+  .loc 1 55
+  .loc 1 55
+  .loc 1 55
+  mov $8, %rax
+  push %rax
+  .loc 2 1
+  lea .L..40(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 56
+  mov $1, %rax
+  push %rax
+  .loc 1 56
+  .loc 1 56
+  .loc 1 56
+  mov $1, %rax
+  push %rax
+  .loc 2 1
+  lea .L..41(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 57
+  mov $3, %rax
+  push %rax
+  .loc 1 57
+  .loc 1 57
+  .loc 1 57
+  mov $3, %rax
+  push %rax
+  .loc 2 1
+  lea .L..42(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 58
+  mov $12, %rax
+  push %rax
+  .loc 1 58
+  .loc 1 58
+  .loc 1 58
+  mov $12, %rax
+  push %rax
+  .loc 2 1
+  lea .L..43(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 59
+  mov $4, %rax
+  push %rax
+  .loc 1 59
+  .loc 1 59
+  .loc 1 59
+  mov $4, %rax
+  push %rax
+  .loc 2 1
+  lea .L..44(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 60
+  mov $3, %rax
+  push %rax
+  .loc 1 60
+  .loc 1 60
+  .loc 1 60
+  .loc 1 60
+  lea -48(%rbp), %rax
+  push %rax
+  .loc 1 60
+  lea -20(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 60
+  .loc 1 60
+  lea -20(%rbp), %rax
+  push %rax
+  .loc 1 60
+  mov $3, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 60
+  .loc 1 60
+  .loc 1 60
+  .loc 1 60
+  lea -48(%rbp), %rax
+  mov (%rax), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..45(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 2 1
+  .loc 2 1
+  .loc 1 61
+  mov $4, %rax
+  push %rax
+  .loc 1 61
+  .loc 1 61
+  .loc 1 61
+  .loc 1 61
+  lea -16(%rbp), %rax
+  push %rax
+  .loc 1 61
+  lea -19(%rbp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  .loc 1 61
+  .loc 1 61
+  .loc 1 61
+  .loc 1 61
+  lea -16(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  .loc 1 61
+  mov $4, %rax
+  pop %rdi
+  mov %al, (%rdi)
+  .loc 1 61
+  .loc 1 61
+  .loc 1 61
+  .loc 1 61
+  lea -16(%rbp), %rax
+  mov (%rax), %rax
+  movsbq (%rax), %rax
+  push %rax
+  .loc 2 1
+  lea .L..46(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  mov $0, %rax
+  call assert
+  .loc 1 65
+  .loc 1 65
+  .loc 1 65
+  lea .L..47(%rip), %rax
+  push %rax
+  pop %rdi
+  mov $0, %rax
+  call printf
+  .loc 1 66
+  .loc 1 66
+  mov $0, %rax
+  jmp .L.return.main
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+  .data
+  .global .L..47
+.L..47:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .data
+  .global .L..46
+.L..46:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 121
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..45
+.L..45:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..44
+.L..44:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..43
+.L..43:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..42
+.L..42:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..41
+.L..41:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..40
+.L..40:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..39
+.L..39:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..38
+.L..38:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..37
+.L..37:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..36
+.L..36:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 97
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 98
+  .byte 61
+  .byte 38
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..35
+.L..35:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 97
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 98
+  .byte 61
+  .byte 38
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..34
+.L..34:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..33
+.L..33:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..32
+.L..32:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..31
+.L..31:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..30
+.L..30:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..29
+.L..29:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..28
+.L..28:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..27
+.L..27:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..26
+.L..26:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..25
+.L..25:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 41
+  .byte 0
+  .data
+  .global .L..24
+.L..24:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 41
+  .byte 0
+  .data
+  .global .L..23
+.L..23:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..22
+.L..22:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..21
+.L..21:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..20
+.L..20:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..19
+.L..19:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 49
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..18
+.L..18:
+  .byte 103
+  .byte 49
+  .byte 0
+  .data
+  .global .L..17
+.L..17:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..16
+.L..16:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..15
+.L..15:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..14
+.L..14:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..13
+.L..13:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..12
+.L..12:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..11
+.L..11:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..10
+.L..10:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..9
+.L..9:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..8
+.L..8:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..7
+.L..7:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..6
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..5
+.L..5:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 43
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..4
+.L..4:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..3
+.L..3:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 98
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..2
+.L..2:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..1
+.L..1:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global .L..0
+.L..0:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .data
+  .global g2
+g2:
+  .zero 16
+  .data
+  .global g1
+g1:
+  .zero 4
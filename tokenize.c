@@ -1,12 +1,35 @@
+// madvise と MAP_ANONYMOUS は POSIX にはないので、その拡張も宣言させる
+#define _DEFAULT_SOURCE
 #include "chibicc.h"
 
-// 入力されたファイル名
-static char *current_filename;
+// 入力ファイルの一覧。インクルードされたファイルも含む。
+static File **input_files;
+static int input_files_cnt;
 
-// 入力プログラム
-static char *current_input;
+// 以下のトークナイザの状態はスレッドごとに持つ。並列にトークナイズする
+// 場合（tokenize_parallel を参照）、各ワーカスレッドはこれらを使って自分の
+// 担当範囲をトークナイズし、その結果をメインスレッドがつなぎ合わせる。
 
-void error(char *fmt, ...) {
+// トークナイズしているファイル
+static _Thread_local File *current_file;
+
+// 次にトークナイズする位置
+static _Thread_local char *current_pos;
+
+// NULL でなければ、この位置に達したところでトークナイズを止める
+static _Thread_local char *current_limit;
+
+// トークナイズ中の現在の行番号
+static _Thread_local int current_line;
+
+// 投機的にトークナイズしている間は、エラーを報告する代わりにここへ戻る
+static _Thread_local jmp_buf *speculative;
+
+// tokenize_parallel が作成したトークンのリスト。空になるまでは、
+// 入力を読む代わりにここからトークンを取り出す。
+static Token *lexed_tokens;
+
+noreturn void error(char *fmt, ...) {
     va_list ap;
     va_start(ap, fmt);
     vfprintf(stderr, fmt, ap);
@@ -14,22 +37,62 @@ void error(char *fmt, ...) {
     exit(1);
 }
 
-// 以下の書式でエラーメッセージを報告しexitする
+// ファイルに新しい行の先頭位置を記録する。増分パースで読み直すときは
+// 行の表がすでにできているので、記録済みの行は記録しない
+static void add_line(File *file, char *p) {
+    if (file->line_cnt && file->line_starts[file->line_cnt - 1] >= p)
+        return;
+    if (file->line_cnt == file->line_cap) {
+        file->line_cap = file->line_cap ? file->line_cap * 2 : 1024;
+        file->line_starts = realloc(file->line_starts, sizeof(char *) * file->line_cap);
+    }
+    file->line_starts[file->line_cnt++] = p;
+}
+
+// `loc` を含む行の行番号を二分探索で求める
+static int find_line(File *file, char *loc) {
+    int lo = 0, hi = file->line_cnt - 1;
+    while (lo < hi) {
+        int mid = (lo + hi + 1) / 2;
+        if (file->line_starts[mid] <= loc)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo + 1;
+}
+
+// パーサがエラーから回復する位置。設定されていれば、位置つきのエラーを
+// 報告した後、exit せずにここへ戻る
+jmp_buf *error_recovery;
+
+// これまでに報告したエラーの数と、報告するエラーの数の上限（0 なら無制限）
+int error_cnt;
+int max_errors = 20;
+
+// 以下の書式でエラーメッセージを報告しexitする。パーサがエラーから回復する
+// 位置を設定していれば、exit せずにそこへ戻る
 //
 // foo.c:10: x = y + 1;
 //               ^ <error message here>
-void verror_at(int line_no, char *loc, char *fmt, va_list ap) {
-    // `loc` を含む行を探す
-    char *line = loc;
-    while (current_input < line && line[-1] != '\n')
-        line--;
+static noreturn void verror_at(File *file, int line_no, char *loc, char *fmt, va_list ap) {
+    // 回復した後で同じ位置のエラーを再び見つけても、報告は一度だけにする
+    static char *last_loc;
+    if (error_recovery && error_cnt && loc == last_loc)
+        longjmp(*error_recovery, 1);
+    last_loc = loc;
 
+    // `loc` を含む行の先頭は行の表から得られる。AST ファイルから読み込んだ
+    // ファイルには行の表がないので、`loc` を行の先頭とする
+    char *line = line_no <= file->line_cnt ? file->line_starts[line_no - 1] : loc;
+
+    // 入力の終わりを指す場合は、'\n' の後ろの '\0' で止める
     char *end = loc;
-    while (*end != '\n')
+    while (*end && *end != '\n')
         end++;
 
     // 該当の行を出力
-    int indent = fprintf(stderr, "%s:%d: ", current_filename, line_no);
+    int indent = fprintf(stderr, "%s:%d: ", file->name, line_no);
     fprintf(stderr, "%.*s\n", (int)(end - line), line);
 
     // エラーメッセージを表示
@@ -39,27 +102,32 @@ void verror_at(int line_no, char *loc, char *fmt, va_list ap) {
     fprintf(stderr, "^ ");
     vfprintf(stderr, fmt, ap);
     fprintf(stderr, "\n");
-    exit(1);
+
+    error_cnt++;
+    if (!error_recovery)
+        exit(1);
+    if (max_errors && error_cnt >= max_errors) {
+        fprintf(stderr, "エラーが多すぎるため中止します\n");
+        exit(1);
+    }
+    longjmp(*error_recovery, 1);
 }
 
 // tokenize に関するエラーを報告するための関数
-void error_at(char *loc, char *fmt, ...) {
-    // 行番号を取得
-    int line_no = 1;
-    for (char *p = current_input; p < loc; p++)
-        if (*p == '\n')
-            line_no++;
+noreturn void error_at(char *loc, char *fmt, ...) {
+    if (speculative)
+        longjmp(*speculative, 1);
 
     va_list ap;
     va_start(ap, fmt);
-    verror_at(line_no, loc, fmt, ap);
+    verror_at(current_file, find_line(current_file, loc), loc, fmt, ap);
 }
 
 // parse に関するエラーを報告するための関数
-void error_tok(Token *tok, char *fmt, ...) {
+noreturn void error_tok(Token *tok, char *fmt, ...) {
     va_list ap;
     va_start(ap, fmt);
-    verror_at(tok->line_no, tok->loc, fmt, ap);
+    verror_at(tok->file, tok->line_no, tok->loc, fmt, ap);
 }
 
 // トークンが指定した演算子であるかどうかを返す
@@ -85,15 +153,70 @@ bool consume(Token **rest, Token *tok, char *str) {
     return false;
 }
 
-// 新しいトークンを作成してcurに繋げる
+// トークンを確保する単位。トークンはこの個数ずつまとめて確保した配列から
+// 順に切り出すので、個々のトークンに malloc のオーバーヘッドはかからず、
+// 連続するトークンはメモリ上でも隣り合う。
+#define TOKEN_CHUNK_SIZE 4096
+
+// トークンの配列と文字列リテラルの内容を確保する領域。並列トークナイズでは
+// ワーカスレッドからも確保するので、ロックを取る
+static Arena token_arena;
+#ifdef PARALLEL_TOKENIZE
+static pthread_mutex_t token_arena_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static void *token_arena_alloc(size_t size) {
+#ifdef PARALLEL_TOKENIZE
+    pthread_mutex_lock(&token_arena_lock);
+#endif
+    void *p = arena_alloc(&token_arena, size);
+#ifdef PARALLEL_TOKENIZE
+    pthread_mutex_unlock(&token_arena_lock);
+#endif
+    return p;
+}
+
+static _Thread_local Token *token_chunk;
+static _Thread_local int token_chunk_left;
+
+// 解放されたトークンのリスト。新しいトークンはまずここから再利用する。
+static _Thread_local Token *free_tokens;
+
+static Token *alloc_token(void) {
+    if (free_tokens) {
+        Token *tok = free_tokens;
+        free_tokens = tok->next;
+        *tok = (Token){};
+        return tok;
+    }
+
+    if (token_chunk_left == 0) {
+        token_chunk = token_arena_alloc(TOKEN_CHUNK_SIZE * sizeof(Token));
+        token_chunk_left = TOKEN_CHUNK_SIZE;
+    }
+    token_chunk_left--;
+    return token_chunk++;
+}
+
+// 新しいトークンを作成する
 static Token *new_token(TokenKind kind, char *start, char *end) {
-    Token *tok = calloc(1, sizeof(Token));
+    Token *tok = alloc_token();
     tok->kind = kind;
     tok->loc = start;
     tok->len = end - start;
+    tok->line_no = current_line;
+    tok->file = current_file;
     return tok;
 }
 
+// トークンを複製する。複製したトークンは次のトークンを持たない。
+Token *copy_token(Token *tok) {
+    Token *t = alloc_token();
+    *t = *tok;
+    t->next = NULL;
+    return t;
+}
+
 // 入力文字列の先頭が指定した文字列から始まっているかどうかを返す
 static bool startswith(char *p, char *q) {
     return memcmp(p, q, strlen(q)) == 0;
@@ -104,11 +227,118 @@ static bool is_ident1(char c) {
     return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_';
 }
 
+//
+// 入力を16バイト単位でまとめて走査するための関数群
+//
+// SSE2 が使える場合は、16バイト境界に揃えたアドレスから16バイトずつ読み、
+// 各バイトが「走査を止めるべき文字」かどうかをビットマスクとして一度に求める。
+// 境界に揃えた読み込みはページをまたがないので、入力の終端を越えて読んでも
+// マップされていないページに触れることはない。どの走査も '\0' で必ず止まる
+// ので、入力の終端より先に進むことはない。
+// SSE2 が使えない環境では、1バイトずつ調べる素朴な実装を用いる。
+//
+
+#ifdef __SSE2__
+
+static __m128i load16(char *p) {
+    return _mm_load_si128((__m128i *)p);
+}
+
+static __m128i eq8(__m128i v, char c) {
+    return _mm_cmpeq_epi8(v, _mm_set1_epi8(c));
+}
+
+// lo <= c && c <= hi であるバイトを求める。0x80 以上のバイトは負の値として
+// 比較されるので、ASCII の範囲を指定する限り一致することはない
+static __m128i range8(__m128i v, char lo, char hi) {
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)),
+                         _mm_cmplt_epi8(v, _mm_set1_epi8(hi + 1)));
+}
+
+static unsigned blank_stop(__m128i v) {
+    return ~_mm_movemask_epi8(_mm_or_si128(eq8(v, ' '), eq8(v, '\t'))) & 0xffff;
+}
+
+static unsigned ident_stop(__m128i v) {
+    __m128i m = _mm_or_si128(range8(v, 'a', 'z'), range8(v, 'A', 'Z'));
+    m = _mm_or_si128(m, range8(v, '0', '9'));
+    m = _mm_or_si128(m, eq8(v, '_'));
+    return ~_mm_movemask_epi8(m) & 0xffff;
+}
+
+static unsigned newline_stop(__m128i v) {
+    return _mm_movemask_epi8(_mm_or_si128(eq8(v, '\n'), eq8(v, '\0')));
+}
+
+static unsigned comment_stop(__m128i v) {
+    __m128i m = _mm_or_si128(eq8(v, '*'), eq8(v, '\n'));
+    return _mm_movemask_epi8(_mm_or_si128(m, eq8(v, '\0')));
+}
+
+static unsigned string_stop(__m128i v) {
+    __m128i m = _mm_or_si128(eq8(v, '"'), eq8(v, '\\'));
+    m = _mm_or_si128(m, eq8(v, '\n'));
+    return _mm_movemask_epi8(_mm_or_si128(m, eq8(v, '\0')));
+}
+
+// p 以降で最初に stop が真になるバイトの位置を返す
+#define SCAN(p, stop)                                     \
+    do {                                                  \
+        int off = (uintptr_t)(p) & 15;                    \
+        char *q = (p) - off;                              \
+        unsigned m = stop(load16(q)) >> off << off;       \
+        while (!m) {                                      \
+            q += 16;                                      \
+            m = stop(load16(q));                          \
+        }                                                 \
+        return q + __builtin_ctz(m);                      \
+    } while (0)
+
+static char *skip_blank(char *p) { SCAN(p, blank_stop); }
+static char *ident_end(char *p) { SCAN(p, ident_stop); }
+static char *find_newline(char *p) { SCAN(p, newline_stop); }
+static char *find_comment_stop(char *p) { SCAN(p, comment_stop); }
+static char *find_string_stop(char *p) { SCAN(p, string_stop); }
+
+#else
+
+static char *skip_blank(char *p) {
+    while (*p == ' ' || *p == '\t')
+        p++;
+    return p;
+}
+
 // cが識別子の２文字目以降の文字として適当ならtrueを返す
 static bool is_ident2(char c) {
     return is_ident1(c) || ('0' <= c && c <= '9');
 }
 
+static char *ident_end(char *p) {
+    while (is_ident2(*p))
+        p++;
+    return p;
+}
+
+static char *find_newline(char *p) {
+    while (*p && *p != '\n')
+        p++;
+    return p;
+}
+
+static char *find_comment_stop(char *p) {
+    while (*p && *p != '*' && *p != '\n')
+        p++;
+    return p;
+}
+
+static char *find_string_stop(char *p) {
+    while (*p && *p != '"' && *p != '\\' && *p != '\n')
+        p++;
+    return p;
+}
+
+#endif
+
 static int from_hex(char c) {
     if ('0' <= c && c <= '9')
         return c - '0';
@@ -117,26 +347,106 @@ static int from_hex(char c) {
     return c - 'A' + 10;
 }
 
-static int read_punct(char *p) {
-    static char *kw[] = {"==", "!=", "<=", ">=", "->"};
-
-    for (int i = 0; i < sizeof(kw) / sizeof(*kw); i++)
-        if (startswith(p, kw[i]))
-            return strlen(kw[i]);
+// 記号を読み、その長さを返す。記号でなければ0を返す。
+// 最初の１文字で分岐し、２文字目を見て２文字の記号かどうかを決める。
+static int read_punct(char *p, TokenId *id) {
+    switch (*p) {
+    case '=':
+        if (p[1] == '=') {
+            *id = PU_EQ;
+            return 2;
+        }
+        break;
+    case '!':
+        if (p[1] == '=') {
+            *id = PU_NE;
+            return 2;
+        }
+        break;
+    case '<':
+        if (p[1] == '=') {
+            *id = PU_LE;
+            return 2;
+        }
+        break;
+    case '>':
+        if (p[1] == '=') {
+            *id = PU_GE;
+            return 2;
+        }
+        break;
+    case '-':
+        if (p[1] == '>') {
+            *id = PU_ARROW;
+            return 2;
+        }
+        break;
+    case '&':
+        if (p[1] == '&') {
+            *id = PU_LOGAND;
+            return 2;
+        }
+        break;
+    case '|':
+        if (p[1] == '|') {
+            *id = PU_LOGOR;
+            return 2;
+        }
+        break;
+    case '.':
+        if (p[1] == '.' && p[2] == '.') {
+            *id = PU_ELLIPSIS;
+            return 3;
+        }
+        break;
+    case '#':
+        if (p[1] == '#') {
+            *id = PU_HASHHASH;
+            return 2;
+        }
+        break;
+    }
 
-    return ispunct(*p) ? 1 : 0;
+    if (!ispunct(*p))
+        return 0;
+    *id = *p;
+    return 1;
 }
 
-static bool is_keyword(Token *tok) {
-    static char *kw[] = {
-        "return", "if", "else", "for", "while", "int", "sizeof", "char",
-        "struct", "union", "short", "long", "void", "typedef"
+// キーワードの完全ハッシュ。先頭２文字と長さの和の下位５ビットは、
+// すべてのキーワードについて異なる値になる。キーワードを追加するときは
+// 衝突しないことを確かめ、衝突するならハッシュ関数を選び直すこと。
+#define KW_HASH(c0, c1, len) (((c0) + (c1) + (len)) & 31)
+#define KW(c0, c1, name, id) [KW_HASH(c0, c1, sizeof(name) - 1)] = {name, id}
+
+// 識別子がキーワードであればそのIDを、そうでなければ ID_NONE を返す
+static TokenId keyword_id(char *p, int len) {
+    static struct {
+        char *name;
+        TokenId id;
+    } table[32] = {
+        KW('r', 'e', "return", KW_RETURN),
+        KW('i', 'f', "if", KW_IF),
+        KW('e', 'l', "else", KW_ELSE),
+        KW('f', 'o', "for", KW_FOR),
+        KW('w', 'h', "while", KW_WHILE),
+        KW('i', 'n', "int", KW_INT),
+        KW('s', 'i', "sizeof", KW_SIZEOF),
+        KW('c', 'h', "char", KW_CHAR),
+        KW('s', 't', "struct", KW_STRUCT),
+        KW('u', 'n', "union", KW_UNION),
+        KW('s', 'h', "short", KW_SHORT),
+        KW('l', 'o', "long", KW_LONG),
+        KW('v', 'o', "void", KW_VOID),
+        KW('t', 'y', "typedef", KW_TYPEDEF),
     };
 
-    for (int i = 0; i < sizeof(kw) / sizeof(*kw); i++)
-        if (equal(tok, kw[i]))
-            return true;
-    return false;
+    // 識別子の後ろには必ず何らかの文字があるので、p[1] は常に読める
+    int h = KW_HASH((unsigned char)p[0], (unsigned char)p[1], len);
+    char *name = table[h].name;
+    if (name && strncmp(name, p, len) == 0 && name[len] == '\0')
+        return table[h].id;
+    return ID_NONE;
 }
 
 static int read_escaped_char(char **new_pos, char *p) {
@@ -192,144 +502,400 @@ static int read_escaped_char(char **new_pos, char *p) {
     }
 }
 
-// 閉じる側のダブルクォートを探す
+// 閉じる側のダブルクォートを探す。エスケープされた改行も行として数える
 static char *string_literal_end(char *p) {
     char *start = p;
-    for (; *p != '"'; p++) {
-        if (*p == '\n' || *p == '\0')
+    for (;;) {
+        p = find_string_stop(p);
+        if (*p == '"')
+            return p;
+        if (*p == '\n' || *p == '\0' || p[1] == '\0')
             error_at(start, "文字列リテラルが閉じられていません");
-        if (*p == '\\')
-            p++;
+        if (p[1] == '\n') {
+            current_line++;
+            add_line(current_file, p + 2);
+        }
+        p += 2;
     }
-    return p;
 }
 
 static Token *read_string_literal(char *start) {
+    // トークンの行番号は、改行を読み進める前の開始位置の行にする
+    int line_no = current_line;
     char *end = string_literal_end(start + 1);
-    char *buf = calloc(1, end - start);
+    char *buf = token_arena_alloc(end - start);
     int len = 0;
 
     for (char *p = start + 1; p < end;) {
-        if (*p == '\\')
+        if (*p == '\\') {
             buf[len++] = read_escaped_char(&p, p + 1);
-        else
-            buf[len++] = *p++;
+            continue;
+        }
+
+        // 次のエスケープシーケンスまではそのままコピーする
+        char *q = memchr(p, '\\', end - p);
+        if (!q)
+            q = end;
+        memcpy(buf + len, p, q - p);
+        len += q - p;
+        p = q;
     }
 
     Token *tok = new_token(TK_STR, start, end + 1);
-    tok->ty = array_of(ty_char, len + 1);
+    tok->line_no = line_no;
+    tok->val = len + 1;
     tok->str = buf;
     return tok;
 }
 
-static void convert_keywords(Token *tok) {
-    for (Token *t = tok; t->kind != TK_EOF; t = t->next)
-        if (is_keyword(t))
-            t->kind = TK_KEYWORD;
-}
+// 入力の現在位置から次のトークンを１つ読んで返す
+static Token *lex_token(void) {
+    char *p = current_pos;
+    Token *tok;
 
-// 全てのトークンについて行の情報を初期化
-static void add_line_numbers(Token *tok) {
-    char *p = current_input;
-    int n = 1;
+    // トークンが行頭にあるか、直前に空白があるか（プリプロセッサが使う）
+    bool at_bol = p == current_file->contents || p[-1] == '\n';
+    bool has_space = false;
 
-    do {
-        if (p == tok->loc) {
-            tok->line_no = n;
-            tok = tok->next;
+    for (;;) {
+        if (*p == '\0' || (current_limit && p >= current_limit)) {
+            tok = new_token(TK_EOF, p, p);
+            break;
         }
-        if (*p == '\n')
-            n++;
-    } while (*p++);
-}
-
-// 入力文字列pをトークナイズしてそれを返す
-static Token *tokenize(char *filename, char *p) {
-    current_filename = filename;
-    current_input = p;
-    Token head = {};
-    Token *cur = &head;
 
-    while (*p) {
         // 行コメントをスキップ
         if (startswith(p, "//")) {
-            p += 2;
-            while (*p != '\n')
-                p++;
+            p = find_newline(p + 2);
+            has_space = true;
             continue;
         }
 
         // ブロックコメントをスキップ
         if (startswith(p, "/*")) {
-            char *q = strstr(p + 2, "*/");
-            if (!q)
-                error_at(p, "ブロックコメントが閉じられていません");
+            char *q = p + 2;
+            for (;;) {
+                q = find_comment_stop(q);
+                if (*q == '\0')
+                    error_at(p, "ブロックコメントが閉じられていません");
+                if (*q == '\n') {
+                    current_line++;
+                    add_line(current_file, ++q);
+                    continue;
+                }
+                if (q[1] == '/')
+                    break;
+                q++;
+            }
             p = q + 2;
+            has_space = true;
+            continue;
+        }
+
+        // 改行をスキップして行の情報を更新
+        if (*p == '\n') {
+            p++;
+            current_line++;
+            add_line(current_file, p);
+            at_bol = true;
+            has_space = false;
             continue;
         }
 
         // 空白文字をスキップ
+        if (*p == ' ' || *p == '\t') {
+            p = skip_blank(p);
+            has_space = true;
+            continue;
+        }
+
         if (isspace(*p)) {
             p++;
+            has_space = true;
             continue;
         }
 
         // 数値リテラル
         if (isdigit(*p)) {
-            cur = cur->next = new_token(TK_NUM, p, p);
+            tok = new_token(TK_NUM, p, p);
             char *q = p;
-            cur->val = strtoul(p, &p, 10);
-            cur->len = p - q;
-            continue;
+            tok->val = strtoul(p, &q, 10);
+            tok->len = q - p;
+            break;
         }
 
         // 文字列リテラル
         if (*p == '"') {
-            cur = cur->next = read_string_literal(p);
-            p += cur->len;
-            continue;
+            tok = read_string_literal(p);
+            break;
         }
 
         // 識別子あるいはキーワード
         if (is_ident1(*p)) {
-            char *start = p;
-            do {
-                p++;
-            } while (is_ident2(*p));
-            cur = cur->next = new_token(TK_IDENT, start, p);
-            continue;
+            char *q = ident_end(p + 1);
+            TokenId id = keyword_id(p, q - p);
+            tok = new_token(id ? TK_KEYWORD : TK_IDENT, p, q);
+            tok->id = id;
+            tok->is_typespec = KW_VOID <= id && id <= KW_TYPEDEF;
+
+            // インターンの表はスレッド間で共有できないので、投機的に
+            // トークナイズしている間は、結果をつなぎ合わせるときに行う
+            if (!id && !speculative)
+                tok->str = intern(p, q - p);
+            break;
         }
 
         // 記号
-        int punct_len = read_punct(p);
+        TokenId id;
+        int punct_len = read_punct(p, &id);
         if (punct_len) {
-            cur = cur->next = new_token(TK_PUNCT, p, p + punct_len);
-            p += cur->len;
-            continue;
+            tok = new_token(TK_PUNCT, p, p + punct_len);
+            tok->id = id;
+            break;
         }
 
         error_at(p, "トークナイズできません");
     }
 
-    cur = cur->next = new_token(TK_EOF, p, p);
-    add_line_numbers(head.next);
-    convert_keywords(head.next);
+    tok->at_bol = at_bol;
+    tok->has_space = has_space;
+    current_pos = tok->loc + tok->len;
+    return tok;
+}
+
+// 入力ファイルから次のトークンを１つ読んで返す。tokenize_parallel で
+// トークナイズ済みであれば、その結果から返す。
+Token *read_token(void) {
+    if (!lexed_tokens)
+        return lex_token();
+
+    Token *tok = lexed_tokens;
+    lexed_tokens = tok->next;
+    return tok;
+}
+
+// ファイル全体をトークナイズして、TK_EOF で終端したリストを返す。
+// 入力ファイルを読んでいる途中で呼んでもよいように、トークナイザの
+// 状態は保存しておいて、最後に元に戻す。
+Token *tokenize(File *file) {
+    File *file0 = current_file;
+    char *pos0 = current_pos;
+    char *limit0 = current_limit;
+    int line0 = current_line;
+
+    current_file = file;
+    current_pos = file->contents;
+    current_limit = NULL;
+    current_line = 1;
+
+    Token head = {};
+    Token *cur = &head;
+    do {
+        cur = cur->next = lex_token();
+    } while (cur->kind != TK_EOF);
+
+    current_file = file0;
+    current_pos = pos0;
+    current_limit = limit0;
+    current_line = line0;
     return head.next;
 }
 
-// 与えられたファイルの内容を返す
-static char *read_file(char *path) {
-    FILE *fp;
+// 不要になったトークンを解放する。解放したトークンは再利用される。
+void free_token(Token *tok) {
+    tok->next = free_tokens;
+    free_tokens = tok;
+}
 
-    if (strcmp(path, "-") == 0) {
-        // 慣習として、与えられたファイル名が "-" のときは stdin から読む
-        fp = stdin;
-    } else {
-        fp = fopen(path, "r");
-        if (!fp)
-            error("cannot open %s: %s", path, strerror(errno));
+// TK_EOF で終端したトークンのリストを解放する
+void release_tokens(Token *tok) {
+    for (;;) {
+        Token *next = tok->next;
+        bool last = tok->kind == TK_EOF;
+        free_token(tok);
+        if (last)
+            return;
+        tok = next;
+    }
+}
+
+//
+// 並列トークナイズ
+//
+// 複数のコアで速くなることがまだ確かめられていないので、PARALLEL_TOKENIZE を
+// 定義してビルドした場合（make PARALLEL=1）にだけ使える実験的な機能とする。
+//
+// 入力を行頭で複数の範囲に分割し、スレッドプールで並列にトークナイズする。
+// ほとんどのトークンは行をまたがないので、各範囲は独立にトークナイズできる。
+// 例外はブロックコメントで、範囲の先頭がコメントの途中にあると、その範囲の
+// 結果は正しくない。そこで各範囲はいったん「コメントの外から始まる」と仮定
+// して投機的にトークナイズしておき、結果を先頭から順につなぎ合わせるときに、
+// 直前の範囲が実際に止まった位置と範囲の先頭が一致しないものや、エラーに
+// なったものだけをメインスレッドでトークナイズし直す。
+//
+
+#ifdef PARALLEL_TOKENIZE
+
+typedef struct {
+    char *start;        // 範囲の先頭（行頭）
+    char *end;          // 範囲の終わり（次の範囲の先頭）
+    char *stop;         // 実際にトークナイズを止めた位置
+    Token *tokens;      // トークナイズの結果（行番号は範囲の先頭からの相対値）
+    Token *last;
+    int lines;          // 通過した改行の数
+    File file;          // 入力ファイルの写し。通過した行の先頭はここに記録する
+    bool failed;        // トークナイズ中にエラーが起きた
+} Chunk;
+
+static Chunk *chunks;
+static int nchunks;
+static atomic_int next_chunk;
+
+// [start, end) をトークナイズしてトークンのリストを返す。リストの最後の
+// トークンは *last に設定する。トークナイズの状態は呼び出したスレッドの
+// ものを用い、トークナイズを止めた位置は current_pos に残る。
+static Token *lex_range(char *start, char *end, Token **last) {
+    Token head = {};
+    Token *cur = &head;
+
+    current_pos = start;
+    current_limit = end;
+    for (;;) {
+        Token *tok = lex_token();
+        if (tok->kind == TK_EOF) {
+            free_token(tok);
+            break;
+        }
+        cur = cur->next = tok;
+    }
+    current_limit = NULL;
+
+    cur->next = NULL;
+    *last = cur;
+    return head.next;
+}
+
+static void *lex_worker(void *arg) {
+    for (;;) {
+        int i = atomic_fetch_add(&next_chunk, 1);
+        if (i >= nchunks)
+            return NULL;
+
+        Chunk *c = &chunks[i];
+        jmp_buf jmp;
+        speculative = &jmp;
+        if (setjmp(jmp)) {
+            c->failed = true;
+            continue;
+        }
+
+        current_file = &c->file;
+        current_line = 1;
+        c->tokens = lex_range(c->start, c->end, &c->last);
+        c->stop = current_pos;
+        c->lines = current_line - 1;
     }
+}
 
+// 残りの入力すべてを nthreads 個のスレッドで並列にトークナイズする。
+// 以降の read_toplevel は、入力を読む代わりにその結果からトークンを返す。
+void tokenize_parallel(int nthreads) {
+    char *start = current_pos;
+    char *end = start + strlen(start);
+
+    // 各スレッドに複数の範囲が行き渡るように分割して、負荷を均す
+    nchunks = nthreads * 4;
+    chunks = calloc(nchunks, sizeof(Chunk));
+    next_chunk = 0;
+
+    char *pos = start;
+    for (int i = 0; i < nchunks; i++) {
+        File *f = &chunks[i].file;
+        f->name = current_file->name;
+        f->file_no = current_file->file_no;
+        f->contents = current_file->contents;
+
+        chunks[i].start = pos;
+        char *target = start + (end - start) * (i + 1) / nchunks;
+        if (target > pos) {
+            char *nl = memchr(target - 1, '\n', end - (target - 1));
+            pos = nl ? nl + 1 : end;
+        }
+        chunks[i].end = (i == nchunks - 1) ? end : pos;
+    }
+
+    pthread_t *threads = calloc(nthreads, sizeof(pthread_t));
+    for (int i = 0; i < nthreads; i++)
+        if (pthread_create(&threads[i], NULL, lex_worker, NULL))
+            error("スレッドを作成できませんでした");
+    for (int i = 0; i < nthreads; i++)
+        pthread_join(threads[i], NULL);
+    free(threads);
+
+    // 範囲ごとの結果を先頭から順につなぎ合わせる
+    Token head = {};
+    Token *cur = &head;
+    pos = start;
+
+    for (int i = 0; i < nchunks; i++) {
+        Chunk *c = &chunks[i];
+
+        // 投機的な結果が使えない範囲は、ワーカが作ったトークンと行の表を
+        // 捨てる。直前の範囲のコメントがこの範囲全体を覆っていれば飛ばし、
+        // そうでなければトークナイズし直す。投機的なトークナイズでエラーに
+        // なった範囲の先頭が正しかった場合は、ここで改めて同じエラーが
+        // 報告される。
+        if (c->failed || pos != c->start) {
+            for (Token *tok = c->tokens, *next; tok; tok = next) {
+                next = tok->next;
+                free_token(tok);
+            }
+            free(c->file.line_starts);
+        }
+        if (pos >= c->end)
+            continue;
+
+        if (c->failed || pos != c->start) {
+            Token *last;
+            Token *tok = lex_range(pos, c->end, &last);
+            if (tok) {
+                cur->next = tok;
+                cur = last;
+            }
+            pos = current_pos;
+            continue;
+        }
+
+        // 行番号とファイルを補正し、識別子をインターンする
+        for (Token *tok = c->tokens; tok; tok = tok->next) {
+            tok->line_no += current_line - 1;
+            tok->file = current_file;
+            if (tok->kind == TK_IDENT)
+                tok->str = intern(tok->loc, tok->len);
+        }
+        for (int j = 0; j < c->file.line_cnt; j++)
+            add_line(current_file, c->file.line_starts[j]);
+        free(c->file.line_starts);
+
+        if (c->tokens) {
+            cur->next = c->tokens;
+            cur = c->last;
+        }
+        current_line += c->lines;
+        pos = c->stop;
+    }
+
+    free(chunks);
+    chunks = NULL;
+
+    current_pos = pos;
+    cur->next = lex_token();
+    lexed_tokens = head.next;
+}
+
+#endif
+
+// ストリームを最後まで読んで、その内容を返す
+static char *read_stream(FILE *fp) {
     char *buf;
     size_t buflen;
     FILE *out = open_memstream(&buf, &buflen);
@@ -343,9 +909,6 @@ static char *read_file(char *path) {
         fwrite(buf2, 1, n, out);
     }
 
-    if (fp != stdin)
-        fclose(fp);
-
     // 最後の行が正しく '\n' で終わっていることを確認する
     fflush(out);
     if (buflen == 0 || buf[buflen - 1] != '\n')
@@ -355,6 +918,272 @@ static char *read_file(char *path) {
     return buf;
 }
 
+// 通常のファイルをメモリにマップして、その内容を返す。
+//
+// トークナイザは入力が '\n' と '\0' で終わっていることを前提としている。
+// そこで、ファイルより少なくとも 2 バイト大きい無名のマッピングを確保して
+// おき、その先頭にファイルを MAP_PRIVATE で重ねてマップする。ファイル末尾
+// より後ろはどちらのマッピングでもゼロなので、'\n' を置けば内容をコピー
+// せずに済む。書き込んでも元のファイルには反映されない。
+static size_t map_len(size_t size) {
+    long pagesize = sysconf(_SC_PAGESIZE);
+    return (size + 2 + pagesize - 1) / pagesize * pagesize;
+}
+
+static char *map_file(int fd, size_t size) {
+    size_t len = map_len(size);
+    if (size == 0)
+        return NULL;
+
+    char *buf = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buf == MAP_FAILED)
+        return NULL;
+    if (mmap(buf, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(buf, len);
+        return NULL;
+    }
+
+    // 余白は既にゼロなので、'\0' を書く必要はない
+    if (buf[size - 1] != '\n')
+        buf[size] = '\n';
+    return buf;
+}
+
+// パイプなどのマップできないストリームを、名前のない一時ファイルに書き写して
+// からマップする。こうすれば通常のファイルと同じく、読み終えた部分を
+// release_consumed_input で手放せる。マップしたファイルの大きさを `mapped`
+// に設定する。一時ファイルを作れなければ NULL を返す
+static char *spool_stream(FILE *fp, size_t *mapped) {
+    FILE *tmp = tmpfile();
+    if (!tmp)
+        return NULL;
+
+    char buf[4096];
+    size_t n, size = 0;
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        if (fwrite(buf, 1, n, tmp) != n)
+            error("一時ファイルに書き込めません: %s", strerror(errno));
+        size += n;
+    }
+
+    char *p = NULL;
+    if (fflush(tmp) == 0 && (p = map_file(fileno(tmp), size)))
+        *mapped = size;
+    fclose(tmp);
+
+    // 空の入力はマップできないので、"\n" だけの内容として扱う
+    return p ? p : strdup("\n");
+}
+
+// 与えられたファイルの内容を返す。メモリにマップした場合は、マップした
+// ファイルの大きさを `mapped` に設定する。そうでなければ 0 を設定する
+static char *read_file(char *path, size_t *mapped) {
+    *mapped = 0;
+
+    // 慣習として、与えられたファイル名が "-" のときは stdin から読む
+    FILE *fp = stdin;
+    if (strcmp(path, "-") != 0) {
+        fp = fopen(path, "r");
+        if (!fp)
+            return NULL;
+    }
+
+    // 通常のファイルであればメモリにマップし、パイプなどであれば一時ファイルを
+    // 介してマップする
+    struct stat st;
+    char *buf = NULL;
+    if (fstat(fileno(fp), &st) == 0 && S_ISREG(st.st_mode)) {
+        if ((buf = map_file(fileno(fp), st.st_size)))
+            *mapped = st.st_size;
+    } else {
+        buf = spool_stream(fp, mapped);
+    }
+    if (!buf)
+        buf = read_stream(fp);
+
+    if (fp != stdin)
+        fclose(fp);
+    return buf;
+}
+
+// ファイルの内容を解放する。メモリにマップした内容はアンマップする
+static void free_contents(File *file) {
+    if (file->mapped)
+        munmap(file->contents, map_len(file->mapped));
+    else
+        free(file->contents);
+    file->contents = NULL;
+    file->mapped = 0;
+}
+
+File **get_input_files(void) {
+    return input_files;
+}
+
+// new_file で作ったすべてのファイル。reset_tokenizer で行の表を解放する
+static File **all_files;
+static int all_files_cnt;
+
+File *new_file(char *name, int file_no, char *contents) {
+    File *file = arena_alloc(&perm_arena, sizeof(File));
+    all_files = realloc(all_files, sizeof(File *) * (all_files_cnt + 1));
+    all_files[all_files_cnt++] = file;
+    file->name = name;
+    file->file_no = file_no;
+    file->contents = contents;
+    add_line(file, contents);
+    return file;
+}
+
+// 内容が `contents` のファイルを、入力ファイルの一覧に加える
+File *add_file(char *name, char *contents) {
+    // 一覧は NULL で終端しておく
+    input_files = realloc(input_files, sizeof(File *) * (input_files_cnt + 2));
+    File *file = new_file(name, input_files_cnt + 1, contents);
+    input_files[input_files_cnt++] = file;
+    input_files[input_files_cnt] = NULL;
+    return file;
+}
+
+// ファイルを読み、入力ファイルの一覧に加える。読めなければ NULL を返す。
+static File *add_input_file(char *path) {
+    size_t mapped;
+    char *p = read_file(path, &mapped);
+    if (!p)
+        return NULL;
+    File *file = add_file(path, p);
+    file->mapped = mapped;
+    return file;
+}
+
+// ファイル全体をトークナイズして返す。ファイルを開けなければ NULL を返す。
 Token *tokenize_file(char *path) {
-    return tokenize(path, read_file(path));
+    File *file = add_input_file(path);
+    if (!file)
+        return NULL;
+    return tokenize(file);
+}
+
+// 与えられたファイルを入力として開き、read_token で読めるようにする
+void open_token_stream(char *path) {
+    current_file = add_input_file(path);
+    if (!current_file)
+        error("cannot open %s: %s", path, strerror(errno));
+    current_pos = current_file->contents;
+    current_line = 1;
+}
+
+// 入力ファイルの次にトークナイズする位置を返す
+char *token_stream_pos(void) {
+    return current_pos;
+}
+
+// release_consumed_input で手放した入力ファイルの先頭からのバイト数
+static size_t released_input;
+
+// 入力ファイルのうち、トークナイズし終えた位置より前のページをカーネルに
+// 返す。パーサが宣言を一つ読み終えるたびに呼ぶので、巨大な入力でも
+// 保持する内容はおおむね宣言一つ分で済む。返したページに後から触れても
+// ファイルから読み直されるだけなので、古いトークンはそのまま使える。
+// 末尾の '\n' を書き込んだかもしれない最後のページは返さない
+void release_consumed_input(void) {
+    File *file = input_files[0];
+    if (!file->mapped || current_file != file || lexed_tokens)
+        return;
+
+    long pagesize = sysconf(_SC_PAGESIZE);
+    size_t end = (current_pos - file->contents) / pagesize * pagesize;
+    size_t last = file->mapped / pagesize * pagesize;
+    if (end > last)
+        end = last;
+    if (end <= released_input)
+        return;
+    madvise(file->contents + released_input, end - released_input, MADV_DONTNEED);
+    released_input = end;
+}
+
+// 入力ファイルの `pos` から読み直すようにする。`pos` はすでにトークナイズした
+// 範囲か、その終わりの位置でなければならない（行番号を行の表から求めるため）
+void seek_token_stream(char *pos) {
+    current_file = input_files[0];
+    current_pos = pos;
+    current_limit = NULL;
+    current_line = find_line(current_file, pos);
+    lexed_tokens = NULL;
+}
+
+// 増分パースで書き換えている入力ファイルの内容と、その大きさ
+static char *edit_buf;
+static size_t edit_cap;
+
+// 入力ファイルの [start, end) バイト目を長さ len の `text` で置き換え、
+// `from` バイト目から読み直すようにする。置き換えた後の内容を返す。
+//
+// 内容は余裕を持たせたバッファの中でその場で書き換えるので、ふつうは
+// `end` より前は動かない。バッファに収まらないときだけ新しいバッファに
+// 移すので、返り値が元の内容と異なれば、呼び出し側は元の内容を指している
+// トークンの位置をすべて付け替えなければならない。
+char *edit_token_stream(int start, int end, char *text, int len, int from) {
+    File *file = input_files[0];
+    char *buf = file->contents;
+    size_t size = strlen(buf);
+    size_t new_size = size - (end - start) + len;
+
+    // '\n' を補う分と、終端の '\0' の分の余裕を見ておく
+    if (buf != edit_buf || new_size + 2 > edit_cap) {
+        edit_cap = (new_size + 2) * 2;
+        char *buf2 = malloc(edit_cap);
+        if (!buf2)
+            error("メモリが足りません");
+        memcpy(buf2, buf, start);
+        memcpy(buf2 + start + len, buf + end, size - end);
+        free_contents(file);
+        buf = edit_buf = buf2;
+    } else {
+        memmove(buf + start + len, buf + end, size - end);
+    }
+    memcpy(buf + start, text, len);
+
+    // トークナイザは入力が '\n' と '\0' で終わっていることを前提としている
+    if (new_size == 0 || buf[new_size - 1] != '\n')
+        buf[new_size++] = '\n';
+    buf[new_size] = '\0';
+
+    // 行の表を作り直す
+    file->contents = buf;
+    file->line_cnt = 0;
+    add_line(file, buf);
+    for (char *p = buf; (p = memchr(p, '\n', buf + new_size - p));)
+        add_line(file, ++p);
+
+    seek_token_stream(buf + from);
+    return buf;
+}
+
+// トークナイザの状態を初期状態に戻す（reset_compiler を参照）。入力ファイルの
+// 内容と行の表、トークンの領域を解放する
+void reset_tokenizer(void) {
+    for (int i = 0; i < input_files_cnt; i++)
+        free_contents(input_files[i]);
+    for (int i = 0; i < all_files_cnt; i++)
+        free(all_files[i]->line_starts);
+    free(input_files);
+    free(all_files);
+    input_files = all_files = NULL;
+    input_files_cnt = all_files_cnt = 0;
+    edit_buf = NULL;
+    edit_cap = 0;
+    released_input = 0;
+
+    arena_release(&token_arena);
+    token_chunk = NULL;
+    token_chunk_left = 0;
+    free_tokens = NULL;
+    lexed_tokens = NULL;
+
+    current_file = NULL;
+    current_pos = current_limit = NULL;
+    current_line = 0;
+    error_recovery = NULL;
+    error_cnt = 0;
 }
\ No newline at end of file
@@ -7,63 +7,74 @@ Type *ty_short = &(Type){TY_SHORT, 2, 2};
 Type *ty_int = &(Type){TY_INT, 4, 4};
 Type *ty_long = &(Type){TY_LONG, 8, 8};
 
-static Type *new_type(TypeKind kind, int size, int align) {
-    Type *ty = calloc(1, sizeof(Type));
-    ty->kind = kind;
-    ty->size = size;
-    ty->align = align;
-    return ty;
-}
-
 bool is_integer(Type *ty) {
     TypeKind k = ty->kind;
     return k == TY_CHAR || k == TY_SHORT || k == TY_INT ||
             k == TY_LONG;
 }
 
-Type *copy_type(Type *ty) {
-    Type *ret = calloc(1, sizeof(Type));
-    *ret = *ty;
-    return ret;
+// 正規化した派生型の表。キーは型の種類と、その型を組み立てる元になった
+// 型（それ自体も正規化されている）へのポインタを並べたもの。キーと型は
+// perm_arena に置く
+static HashMap derived_types;
+
+// `ty` と同じ構造の型を返す。はじめて現れた構造であれば `ty` を複製して
+// 登録する。
+static Type *intern_type(Type *ty) {
+    int keylen = sizeof(uintptr_t) * (4 + ty->param_cnt);
+    uintptr_t key[4 + ty->param_cnt];
+    key[0] = ty->kind;
+    key[1] = (uintptr_t)ty->base;
+    key[2] = ty->array_len;
+    key[3] = (uintptr_t)ty->return_ty;
+    for (int i = 0; i < ty->param_cnt; i++)
+        key[4 + i] = (uintptr_t)ty->params[i];
+
+    Type *canon = hashmap_get2(&derived_types, (char *)key, keylen);
+    if (canon)
+        return canon;
+
+    canon = arena_alloc(&perm_arena, sizeof(Type));
+    *canon = *ty;
+    if (ty->param_cnt)
+        canon->params = memcpy(arena_alloc(&perm_arena, sizeof(Type *) * ty->param_cnt),
+                               ty->params, sizeof(Type *) * ty->param_cnt);
+    char *copy = memcpy(arena_alloc(&perm_arena, keylen), key, keylen);
+    hashmap_put2(&derived_types, copy, keylen, canon);
+    return canon;
 }
 
 Type *pointer_to(Type *base) {
-    Type *ty = new_type(TY_PTR, 8, 8);
-    ty->base = base;
-    return ty;
+    Type ty = {TY_PTR, 8, 8};
+    ty.base = base;
+    return intern_type(&ty);
 }
 
-Type *func_type(Type *return_ty) {
-    Type *ty = calloc(1, sizeof(Type));
-    ty->kind = TY_FUNC;
-    ty->return_ty = return_ty;
-    return ty;
+Type *func_type(Type *return_ty, Type **params, int param_cnt) {
+    Type ty = {TY_FUNC};
+    ty.return_ty = return_ty;
+    ty.params = params;
+    ty.param_cnt = param_cnt;
+    return intern_type(&ty);
 }
 
 Type *array_of(Type *base, int len) {
-    Type *ty = new_type(TY_ARRAY, base->size * len, base->align);
-    ty->base = base;
-    ty->array_len = len;
-    return ty;
+    Type ty = {TY_ARRAY, base->size * len, base->align};
+    ty.base = base;
+    ty.array_len = len;
+    return intern_type(&ty);
 }
 
-void add_type(Node *node) {
-    if (!node || node->ty)
-        return;
-
-    add_type(node->lhs);
-    add_type(node->rhs);
-    add_type(node->cond);
-    add_type(node->then);
-    add_type(node->els);
-    add_type(node->init);
-    add_type(node->inc);
-
-    for (Node *n = node->body; n; n = n->next)
-        add_type(n);
-    for (Node *n = node->args; n; n = n->next)
-        add_type(n);
+// 正規化した派生型をすべて忘れる。型は perm_arena とともに解放される
+void reset_types(void) {
+    free(derived_types.buckets);
+    derived_types = (HashMap){};
+}
 
+// 式のノードに型をつける。パーサはノードを組み立てるたびにこれを呼ぶので、
+// 子ノードの型はすでに決まっている。構文木をたどり直すことはない。
+// 文のノードには型をつけない。
+void add_type(Node *node) {
     switch (node->kind) {
     case ND_ADD:
     case ND_SUB: